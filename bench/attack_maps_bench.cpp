@@ -0,0 +1,95 @@
+#include "bench_utils.hpp"
+
+#include "mpham_chess/bitboard.hpp"
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/movegen.hpp"
+#include "mpham_chess/movelist.hpp"
+#include "mpham_chess/perft.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string_view>
+#include <vector>
+using namespace mpham_chess;
+
+namespace {
+
+constexpr std::array<std::string_view, 4> bench_fens{
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1"};
+
+constexpr unsigned int positions_depth{3};
+constexpr unsigned int perft_depth{5};
+constexpr std::size_t n_repeats{16};
+constexpr std::size_t n_runs{3};
+
+void collect_positions(board &pos, unsigned int depth,
+                       std::vector<board> &positions) noexcept {
+  positions.push_back(pos);
+  if (depth == 0) {
+    return;
+  }
+
+  move_list mvlist{};
+  generate_moves<move_gen_type::legal>(pos, mvlist);
+  for (auto mv : mvlist) {
+    state_info prev_state{};
+    pos.do_move(mv, prev_state);
+    collect_positions(pos, depth - 1, positions);
+    pos.undo_move(mv, prev_state);
+  }
+}
+
+} // namespace
+
+int main() {
+  // Built once per strategy: compare a default build (attack maps
+  // recomputed on every query) against a `USE_ATTACK_MAPS` build
+  // (incrementally updated by every piece update, queries are loads).
+  std::cout << "attack maps: "
+            << (use_attack_maps ? "incremental (USE_ATTACK_MAPS)"
+                                : "recomputed")
+            << ", sizeof(board): " << sizeof(board) << " bytes\n";
+
+  std::vector<board> positions{};
+  for (const auto fen : bench_fens) {
+    board pos{fen};
+    collect_positions(pos, positions_depth, positions);
+  }
+
+  // queries only (e.g. castling path safety)
+  std::uint64_t checksum{0};
+  const auto query_secs{bench::time_it_best_of(n_runs, [&] {
+    auto acc{constants::bb::empty};
+    for (std::size_t rep{0}; rep < n_repeats; rep++) {
+      for (const auto &pos : positions) {
+        acc += pos.attacks_by_color<color::white>() |
+               pos.attacks_by_color<color::black>();
+      }
+    }
+    checksum = std::uint64_t{acc};
+    return checksum;
+  })};
+  bench::report("  attacks_by_color (x2)", positions.size() * n_repeats,
+                query_secs);
+  std::cout << "    checksum " << checksum << '\n';
+
+  // updates and queries (castling generation) in a tree walk
+  std::size_t perft_nodes_total{0};
+  const auto perft_secs{bench::time_it_best_of(n_runs, [&] {
+    perft_nodes_total = 0;
+    for (const auto fen : bench_fens) {
+      board pos{fen};
+      perft_nodes_total += perft_nodes<false>(pos, perft_depth);
+    }
+    return perft_nodes_total;
+  })};
+  bench::report("  perft_nodes (leaf moves)", perft_nodes_total, perft_secs);
+
+  return 0;
+}
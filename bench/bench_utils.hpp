@@ -0,0 +1,46 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+#include <utility>
+
+namespace bench {
+
+template <typename func_t>
+[[nodiscard]] auto time_it(func_t &&func) noexcept {
+  // returns (result of `func`, elapsed seconds)
+  const auto start{std::chrono::steady_clock::now()};
+  auto res{std::forward<func_t>(func)()};
+  const auto stop{std::chrono::steady_clock::now()};
+  return std::pair{res,
+                   std::chrono::duration<double>(stop - start).count()};
+}
+
+template <typename func_t>
+[[nodiscard]] double time_it_best_of(std::size_t n_runs,
+                                     func_t &&func) noexcept {
+  // best elapsed seconds over `n_runs` runs
+  double best{0.0};
+  for (std::size_t run{0}; run < n_runs; run++) {
+    const auto [res, secs]{time_it(func)};
+    static_cast<void>(res);
+    if (run == 0 || secs < best) {
+      best = secs;
+    }
+  }
+  return best;
+}
+
+inline void report(std::string_view name, std::size_t count,
+                   double secs) noexcept {
+  // count, time and throughput (millions per second)
+  std::cout << std::left << std::setw(28) << name << std::right
+            << std::setw(14) << count << std::setw(10) << std::fixed
+            << std::setprecision(3) << secs << " s" << std::setw(10)
+            << std::setprecision(2) << (count / secs / 1e6) << " M/s\n";
+}
+
+} // namespace bench
@@ -0,0 +1,133 @@
+#include "bench_utils.hpp"
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/movegen.hpp"
+#include "mpham_chess/movelist.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+using namespace mpham_chess;
+
+namespace {
+
+constexpr std::array<std::string_view, 4> bench_fens{
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1"};
+
+constexpr unsigned int positions_depth{3};
+constexpr std::size_t n_repeats{4};
+constexpr std::size_t n_runs{3};
+
+void collect_fens(board &pos, unsigned int depth,
+                  std::vector<std::string> &fens) noexcept {
+  fens.push_back(pos.to_fen());
+  if (depth == 0) {
+    return;
+  }
+
+  move_list mvlist{};
+  generate_moves<move_gen_type::legal>(pos, mvlist);
+  for (auto mv : mvlist) {
+    state_info prev_state{};
+    pos.do_move(mv, prev_state);
+    collect_fens(pos, depth - 1, fens);
+    pos.undo_move(mv, prev_state);
+  }
+}
+
+} // namespace
+
+int main() {
+  // FEN throughput (e.g. loading positions from dataset files): parsing into
+  // a reused board, writing into a reused buffer and the allocating `to_fen`,
+  // against the packed binary format (`board::pack`/`board::unpack`)
+  std::vector<std::string> fens{};
+  for (const auto fen : bench_fens) {
+    board pos{fen};
+    collect_fens(pos, positions_depth, fens);
+  }
+  const auto n_fens{fens.size() * n_repeats};
+  std::cout << "FENs: " << fens.size() << " (x" << n_repeats << ")\n";
+
+  std::uint64_t checksum{0};
+  const auto load_secs{bench::time_it_best_of(n_runs, [&] {
+    board pos{};
+    std::uint64_t acc{0};
+    for (std::size_t rep{0}; rep < n_repeats; rep++) {
+      for (const auto &fen : fens) {
+        pos.load_fen(fen);
+        acc += pos.get_hash();
+      }
+    }
+    checksum = acc;
+    return acc;
+  })};
+  bench::report("  load_fen", n_fens, load_secs);
+  std::cout << "    checksum " << checksum << '\n';
+
+  std::vector<board> positions{};
+  positions.reserve(fens.size());
+  for (const auto &fen : fens) {
+    positions.emplace_back(fen);
+  }
+
+  const auto write_secs{bench::time_it_best_of(n_runs, [&] {
+    fen_buffer buf{};
+    std::size_t n_chars{0};
+    for (std::size_t rep{0}; rep < n_repeats; rep++) {
+      for (const auto &pos : positions) {
+        n_chars += pos.write_fen(buf).size();
+      }
+    }
+    return n_chars;
+  })};
+  bench::report("  write_fen", n_fens, write_secs);
+
+  const auto to_fen_secs{bench::time_it_best_of(n_runs, [&] {
+    std::size_t n_chars{0};
+    for (std::size_t rep{0}; rep < n_repeats; rep++) {
+      for (const auto &pos : positions) {
+        n_chars += pos.to_fen().size();
+      }
+    }
+    return n_chars;
+  })};
+  bench::report("  to_fen (allocating)", n_fens, to_fen_secs);
+
+  std::vector<packed_board> packed_positions{};
+  packed_positions.reserve(positions.size());
+  const auto pack_secs{bench::time_it_best_of(n_runs, [&] {
+    std::uint64_t acc{0};
+    for (std::size_t rep{0}; rep < n_repeats; rep++) {
+      packed_positions.clear();
+      for (const auto &pos : positions) {
+        packed_positions.push_back(pos.pack());
+        acc += packed_positions.back()._occupied;
+      }
+    }
+    return acc;
+  })};
+  bench::report("  pack", n_fens, pack_secs);
+
+  const auto unpack_secs{bench::time_it_best_of(n_runs, [&] {
+    board pos{};
+    std::uint64_t acc{0};
+    for (std::size_t rep{0}; rep < n_repeats; rep++) {
+      for (const auto &packed : packed_positions) {
+        pos.unpack(packed);
+        acc += pos.get_hash();
+      }
+    }
+    return acc;
+  })};
+  bench::report("  unpack", n_fens, unpack_secs);
+
+  return 0;
+}
@@ -0,0 +1,59 @@
+#include "bench_utils.hpp"
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/perft.hpp"
+#include "mpham_chess/perft_table.hpp"
+
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <string_view>
+using namespace mpham_chess;
+
+namespace {
+
+struct bench_position {
+  std::string_view _fen{};
+  unsigned int _min_depth{0};
+  unsigned int _max_depth{0};
+};
+
+// from few transpositions (start position) to many (pawn endings, Fine #70)
+constexpr std::array<bench_position, 3> bench_positions{
+    bench_position{"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+                   4, 6},
+    bench_position{"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1", 5, 7},
+    bench_position{"8/k7/3p4/p2P1p2/P2P1P2/8/8/K7 w - - 0 1", 8, 12}};
+
+constexpr std::size_t table_size_mb{256};
+
+} // namespace
+
+int main() {
+  // bulk counting perft against hashed perft (fresh table per run) by depth,
+  // the speedup grows with the depth and the number of transpositions
+  for (const auto &[fen, min_depth, max_depth] : bench_positions) {
+    std::cout << fen << '\n';
+    for (auto depth{min_depth}; depth <= max_depth; depth++) {
+      board pos{fen};
+      const auto [bulk_nodes, bulk_t]{
+          bench::time_it([&] { return perft_nodes<true>(pos, depth); })};
+      const auto [hashed_nodes, hashed_t]{bench::time_it([&] {
+        perft_table table{table_size_mb};
+        return perft<perft_stat::nodes>(pos, depth, table)._nodes[depth];
+      })};
+      if (hashed_nodes != bulk_nodes) {
+        std::cerr << "node count mismatch\n";
+        return 1;
+      }
+
+      std::cout << "  depth " << depth << '\n';
+      bench::report("    perft_nodes (bulk count)", bulk_nodes, bulk_t);
+      bench::report("    perft (hashed)", hashed_nodes, hashed_t);
+      std::cout << "    speedup " << (bulk_t / hashed_t) << "x\n";
+    }
+  }
+
+  return 0;
+}
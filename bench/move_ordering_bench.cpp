@@ -0,0 +1,151 @@
+#include "bench_utils.hpp"
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/constants.hpp"
+#include "mpham_chess/move.hpp"
+#include "mpham_chess/movegen.hpp"
+#include "mpham_chess/movelist.hpp"
+#include "mpham_chess/rng.hpp"
+
+#include "detail/fixed_vector.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <string_view>
+#include <vector>
+using namespace mpham_chess;
+
+namespace {
+
+constexpr std::array<std::string_view, 4> bench_fens{
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1"};
+
+constexpr unsigned int positions_depth{3};
+constexpr std::size_t n_runs{3};
+
+// the moves of one position with (random) ordering scores
+struct scored_moves {
+  move_list _moves{};
+  std::vector<move_score> _scores{};
+};
+
+struct sort_entry {
+  move_score _score{0};
+  move _move{};
+};
+
+void collect_moves(board &pos, unsigned int depth, rng::xorshift64 &rng,
+                   std::vector<scored_moves> &all_moves) noexcept {
+  move_list mvlist{};
+  generate_moves<move_gen_type::legal>(pos, mvlist);
+  if (depth == 0) {
+    auto &moves{all_moves.emplace_back()};
+    moves._moves = mvlist;
+    for (std::size_t ind{0}; ind < mvlist.size(); ind++) {
+      moves._scores.push_back(static_cast<move_score>(rng.generate() % 1000));
+    }
+    return;
+  }
+
+  for (auto mv : mvlist) {
+    state_info prev_state{};
+    pos.do_move(mv, prev_state);
+    collect_moves(pos, depth - 1, rng, all_moves);
+    pos.undo_move(mv, prev_state);
+  }
+}
+
+[[nodiscard]] std::uint64_t
+pick_first_moves(const std::vector<scored_moves> &all_moves,
+                 std::size_t n_used) noexcept {
+  // lazy selection of the `n_used` best moves
+  std::uint64_t acc{0};
+  scored_move_list scored_mvlist{};
+  for (const auto &[moves, scores] : all_moves) {
+    scored_mvlist.clear();
+    for (std::size_t ind{0}; ind < moves.size(); ind++) {
+      scored_mvlist.push_back(moves[ind], scores[ind]);
+    }
+    for (std::size_t n_picked{0}; n_picked < n_used; n_picked++) {
+      const auto mv{scored_mvlist.pick_next()};
+      if (!mv) {
+        break;
+      }
+      acc += static_cast<std::uint64_t>(scored_mvlist.get_score(n_picked));
+    }
+  }
+  return acc;
+}
+
+[[nodiscard]] std::uint64_t
+sort_first_moves(const std::vector<scored_moves> &all_moves,
+                 std::size_t n_used) noexcept {
+  // full sort, then the `n_used` best moves
+  std::uint64_t acc{0};
+  detail::fixed_vector<sort_entry, constants::max_moves, false> sorted{};
+  for (const auto &[moves, scores] : all_moves) {
+    sorted.clear();
+    for (std::size_t ind{0}; ind < moves.size(); ind++) {
+      sorted.emplace_back(scores[ind], moves[ind]);
+    }
+    std::sort(
+        sorted.begin(), sorted.end(),
+        [](const auto &lhs, const auto &rhs) { return lhs._score > rhs._score; });
+    for (std::size_t ind{0}; ind < std::min(n_used, sorted.size()); ind++) {
+      acc += static_cast<std::uint64_t>(sorted[ind]._score);
+    }
+  }
+  return acc;
+}
+
+} // namespace
+
+int main() {
+  // ordering cost when only the first moves are searched (e.g. cutoffs):
+  // `scored_move_list::pick_next` against a full sort of the list
+  std::vector<scored_moves> all_moves{};
+  rng::xorshift64 rng{};
+  for (const auto fen : bench_fens) {
+    board pos{fen};
+    collect_moves(pos, positions_depth, rng, all_moves);
+  }
+  std::cout << "move lists: " << all_moves.size() << '\n';
+
+  for (const std::size_t n_used :
+       {std::size_t{1}, std::size_t{3}, std::size_t{8},
+        std::numeric_limits<std::size_t>::max()}) {
+    if (pick_first_moves(all_moves, n_used) !=
+        sort_first_moves(all_moves, n_used)) {
+      std::cerr << "picked scores mismatch\n";
+      return 1;
+    }
+
+    if (n_used == std::numeric_limits<std::size_t>::max()) {
+      std::cout << "all moves used\n";
+    } else {
+      std::cout << n_used << " moves used\n";
+    }
+    std::uint64_t pick_checksum{0}, sort_checksum{0};
+    const auto pick_secs{bench::time_it_best_of(n_runs, [&] {
+      pick_checksum = pick_first_moves(all_moves, n_used);
+      return pick_checksum;
+    })};
+    const auto sort_secs{bench::time_it_best_of(n_runs, [&] {
+      sort_checksum = sort_first_moves(all_moves, n_used);
+      return sort_checksum;
+    })};
+    bench::report("  pick_next", all_moves.size(), pick_secs);
+    bench::report("  std::sort", all_moves.size(), sort_secs);
+    std::cout << "    checksums " << pick_checksum << ' ' << sort_checksum
+              << '\n';
+  }
+
+  return 0;
+}
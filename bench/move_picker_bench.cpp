@@ -0,0 +1,214 @@
+#include "bench_utils.hpp"
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/constants.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/move.hpp"
+#include "mpham_chess/move_picker.hpp"
+#include "mpham_chess/movegen.hpp"
+#include "mpham_chess/movelist.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <string_view>
+#include <vector>
+using namespace mpham_chess;
+
+namespace {
+
+constexpr std::array<std::string_view, 4> bench_fens{
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1"};
+
+constexpr int bench_depth{6};
+constexpr std::size_t hash_table_size{1 << 20};
+constexpr int mate_score{100000};
+constexpr std::array<int, constants::n_piece_types> piece_values{
+    100, 300, 300, 500, 900, 0};
+
+// upfront ordering scores (the staged order of `move_picker`)
+constexpr move_score hash_move_score{1 << 20};
+constexpr move_score capture_score{1 << 16};
+constexpr move_score killer_score{1 << 15};
+
+enum class ordering { upfront, staged };
+
+struct search_stats {
+  std::size_t _nodes{0};
+  // (staged) nodes cut off before generating the captures / the quiets
+  std::size_t _skipped_capture_gens{0};
+  std::size_t _skipped_quiet_gens{0};
+};
+
+struct hash_entry {
+  zobrist_hash _hash{0};
+  move _best_move{};
+};
+
+[[nodiscard]] int evaluate(const board &pos) noexcept {
+  // material, from the side to move
+  int score{0};
+  for (auto pt_ind{0}; pt_ind < constants::n_piece_types; pt_ind++) {
+    const piece_type pt{pt_ind};
+    score += piece_values[pt_ind] *
+             (static_cast<int>(pos.get_piece_bb(color::white, pt).bit_count()) -
+              static_cast<int>(pos.get_piece_bb(color::black, pt).bit_count()));
+  }
+  return (pos.get_side_to_move() == color::white) ? score : -score;
+}
+
+template <ordering ord> class searcher {
+private:
+  std::vector<hash_entry> _hash_table{hash_table_size};
+  std::array<killer_moves, bench_depth + 1> _killers{};
+  search_stats _stats{};
+
+public:
+  [[nodiscard]] search_stats run(board &pos) noexcept {
+    // iterative deepening, fills the hash moves and killers
+    for (auto depth{1}; depth <= bench_depth; depth++) {
+      static_cast<void>(search(pos, depth, 0, -mate_score, mate_score));
+    }
+    return _stats;
+  }
+
+private:
+  int search(board &pos, int depth, int ply, int alpha, int beta) noexcept {
+    _stats._nodes++;
+    if (depth == 0) {
+      return evaluate(pos);
+    }
+
+    auto &entry{_hash_table[pos.get_hash() % hash_table_size]};
+    const auto hash_move{(entry._hash == pos.get_hash()) ? entry._best_move
+                                                         : move{}};
+    auto &killers{_killers[ply]};
+
+    auto best_score{-mate_score};
+    auto best_move{move{}};
+    auto n_legal{0};
+    const auto search_move = [&](move mv) -> bool {
+      // true on a cutoff
+      state_info prev_state{};
+      pos.do_move(mv, prev_state);
+      if (pos.template is_check<false>()) {
+        pos.undo_move(mv, prev_state);
+        return false;
+      }
+      n_legal++;
+      const auto score{-search(pos, depth - 1, ply + 1, -beta, -alpha)};
+      pos.undo_move(mv, prev_state);
+
+      if (score > best_score) {
+        best_score = score;
+        best_move = mv;
+      }
+      alpha = std::max(alpha, score);
+      if (alpha < beta) {
+        return false;
+      }
+      if (!mv.is_capture() && !mv.is_promote() && (killers[0] != mv)) {
+        killers[1] = killers[0];
+        killers[0] = mv;
+      }
+      return true;
+    };
+
+    if constexpr (ord == ordering::staged) {
+      move_picker picker{pos, hash_move, killers};
+      while (const auto mv{picker.next_move()}) {
+        if (search_move(*mv)) {
+          const auto stage{picker.get_stage()};
+          _stats._skipped_capture_gens += (stage == pick_stage::gen_captures);
+          _stats._skipped_quiet_gens += (stage < pick_stage::gen_quiets);
+          break;
+        }
+      }
+    } else {
+      scored_move_list scored_mvlist{};
+      if (pos.is_check()) {
+        generate_moves<move_gen_type::evasions>(pos, scored_mvlist.get_moves());
+      } else {
+        generate_moves<move_gen_type::pseudolegal>(pos,
+                                                   scored_mvlist.get_moves());
+      }
+      scored_mvlist.score_moves([&](move mv) -> move_score {
+        if (mv == hash_move) {
+          return hash_move_score;
+        }
+        if (mv.is_capture() || mv.is_promote()) {
+          return capture_score + mvv_lva_score(pos, mv);
+        }
+        if (const auto it{std::ranges::find(killers, mv)};
+            it != killers.end()) {
+          return killer_score - static_cast<move_score>(it - killers.begin());
+        }
+        return 0;
+      });
+      while (const auto mv{scored_mvlist.pick_next()}) {
+        if (search_move(*mv)) {
+          break;
+        }
+      }
+    }
+
+    if (n_legal == 0) {
+      return pos.is_check() ? -mate_score + ply : 0;
+    }
+    entry = hash_entry{pos.get_hash(), best_move};
+    return best_score;
+  }
+};
+
+} // namespace
+
+int main() {
+  // alpha-beta search (material only, hash moves and killers) ordering all
+  // pseudolegal moves (evasions in check) upfront against the staged
+  // `move_picker`
+  search_stats upfront_total{}, staged_total{};
+  double upfront_secs{0.0}, staged_secs{0.0};
+
+  for (const auto fen : bench_fens) {
+    std::cout << fen << '\n';
+    board upfront_pos{fen};
+    board staged_pos{fen};
+
+    const auto [upfront_stats, upfront_t]{bench::time_it([&] {
+      searcher<ordering::upfront> upfront_searcher{};
+      return upfront_searcher.run(upfront_pos);
+    })};
+    const auto [staged_stats, staged_t]{bench::time_it([&] {
+      searcher<ordering::staged> staged_searcher{};
+      return staged_searcher.run(staged_pos);
+    })};
+
+    bench::report("  upfront (nodes)", upfront_stats._nodes, upfront_t);
+    bench::report("  move_picker (nodes)", staged_stats._nodes, staged_t);
+    std::cout << "    cutoffs before captures generated: "
+              << staged_stats._skipped_capture_gens
+              << ", before quiets generated: "
+              << staged_stats._skipped_quiet_gens << '\n';
+
+    upfront_total._nodes += upfront_stats._nodes;
+    staged_total._nodes += staged_stats._nodes;
+    staged_total._skipped_capture_gens += staged_stats._skipped_capture_gens;
+    staged_total._skipped_quiet_gens += staged_stats._skipped_quiet_gens;
+    upfront_secs += upfront_t;
+    staged_secs += staged_t;
+  }
+
+  std::cout << "total\n";
+  bench::report("  upfront (nodes)", upfront_total._nodes, upfront_secs);
+  bench::report("  move_picker (nodes)", staged_total._nodes, staged_secs);
+  std::cout << "    cutoffs before captures generated: "
+            << staged_total._skipped_capture_gens
+            << ", before quiets generated: "
+            << staged_total._skipped_quiet_gens << '\n';
+
+  return 0;
+}
@@ -0,0 +1,64 @@
+#include "bench_utils.hpp"
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/perft.hpp"
+
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <string_view>
+using namespace mpham_chess;
+
+namespace {
+
+constexpr std::array<std::string_view, 4> bench_fens{
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1"};
+
+constexpr unsigned int bench_depth{5};
+
+} // namespace
+
+int main() {
+  // leaf path comparison: full statistics vs counts-only vs bulk counting
+  std::size_t full_nodes{0}, leaf_nodes{0}, bulk_nodes{0};
+  double full_secs{0.0}, leaf_secs{0.0}, bulk_secs{0.0};
+
+  for (const auto fen : bench_fens) {
+    board pos{fen};
+    std::cout << fen << '\n';
+
+    const auto [full_res, full_t]{
+        bench::time_it([&] { return perft(pos, bench_depth); })};
+    const auto [leaf_res, leaf_t]{
+        bench::time_it([&] { return perft_nodes<false>(pos, bench_depth); })};
+    const auto [bulk_res, bulk_t]{
+        bench::time_it([&] { return perft_nodes<true>(pos, bench_depth); })};
+
+    bench::report("  perft (full stats)", full_res._nodes[bench_depth],
+                  full_t);
+    bench::report("  perft_nodes (leaf moves)", leaf_res, leaf_t);
+    bench::report("  perft_nodes (bulk count)", bulk_res, bulk_t);
+
+    if (leaf_res != full_res._nodes[bench_depth] || bulk_res != leaf_res) {
+      std::cerr << "node count mismatch\n";
+      return 1;
+    }
+
+    full_nodes += full_res._nodes[bench_depth];
+    leaf_nodes += leaf_res;
+    bulk_nodes += bulk_res;
+    full_secs += full_t;
+    leaf_secs += leaf_t;
+    bulk_secs += bulk_t;
+  }
+
+  std::cout << "total\n";
+  bench::report("  perft (full stats)", full_nodes, full_secs);
+  bench::report("  perft_nodes (leaf moves)", leaf_nodes, leaf_secs);
+  bench::report("  perft_nodes (bulk count)", bulk_nodes, bulk_secs);
+
+  return 0;
+}
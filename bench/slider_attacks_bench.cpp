@@ -0,0 +1,103 @@
+#include "bench_utils.hpp"
+
+#include "mpham_chess/attacks.hpp"
+#include "mpham_chess/bitboard.hpp"
+#include "mpham_chess/constants.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/rng.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+using namespace mpham_chess;
+
+namespace {
+
+constexpr std::size_t n_queries{1 << 16};
+constexpr std::size_t n_repeats{256};
+constexpr std::size_t n_runs{5};
+
+using query = std::pair<square, bitboard>;
+
+[[nodiscard]] std::vector<query> make_queries() noexcept {
+  // random slider squares with ~25% dense random occupancies
+  rng::xorshift64 rng{};
+  std::vector<query> queries{};
+  queries.reserve(n_queries);
+  for (std::size_t ind{0}; ind < n_queries; ind++) {
+    const square sq{static_cast<int>(rng.generate() % constants::n_squares)};
+    const bitboard occupancy{rng.generate() & rng.generate()};
+    queries.emplace_back(sq, occupancy);
+  }
+  return queries;
+}
+
+template <slider_lookup lookup>
+void bench_lookup(const char *name, const std::vector<query> &queries) {
+  // queen attacks (one bishop and one rook lookup) with tables indexed by
+  // `lookup`, built locally so both backends can run in the same binary
+  const auto bishop_tbl{
+      attacks::magics::make_slider_attack_table<piece_type::bishop, lookup>()};
+  const auto rook_tbl{
+      attacks::magics::make_slider_attack_table<piece_type::rook, lookup>()};
+
+  const auto &bishop_magics{attacks::magics::slider_magics<piece_type::bishop>};
+  const auto &rook_magics{attacks::magics::slider_magics<piece_type::rook>};
+
+  std::uint64_t checksum{0};
+  const auto secs{bench::time_it_best_of(n_runs, [&] {
+    auto acc{constants::bb::empty};
+    for (std::size_t rep{0}; rep < n_repeats; rep++) {
+      for (const auto &[sq, occupancy] : queries) {
+        const auto &bishop_magic{bishop_magics[std::to_underlying(sq)]};
+        const auto &rook_magic{rook_magics[std::to_underlying(sq)]};
+        const auto bishop_key{
+            bishop_magic.template get_attack_table_key<lookup>(occupancy)};
+        const auto rook_key{
+            rook_magic.template get_attack_table_key<lookup>(occupancy)};
+        acc += bishop_tbl[bishop_key] | rook_tbl[rook_key];
+      }
+    }
+    checksum = std::uint64_t{acc};
+    return checksum;
+  })};
+
+  bench::report(name, n_queries * n_repeats, secs);
+  std::cout << "    checksum " << checksum << '\n';
+}
+
+} // namespace
+
+int main() {
+  const auto queries{make_queries()};
+
+  std::cout << "queen attack lookups (" << n_queries << " random positions x "
+            << n_repeats << ")\n";
+
+  bench_lookup<slider_lookup::magic>("  magic (multiply-shift)", queries);
+#if defined(__BMI2__)
+  bench_lookup<slider_lookup::pext>("  pext (BMI2)", queries);
+#else
+  std::cout << "  pext (BMI2)                 skipped: configure with "
+               "-DUSE_PEXT=ON on a BMI2 CPU\n";
+#endif
+
+  // production lookup (global tables, default backend)
+  std::uint64_t checksum{0};
+  const auto secs{bench::time_it_best_of(n_runs, [&] {
+    auto acc{constants::bb::empty};
+    for (std::size_t rep{0}; rep < n_repeats; rep++) {
+      for (const auto &[sq, occupancy] : queries) {
+        acc += attacks::slider_attacks<piece_type::queen>(sq, occupancy);
+      }
+    }
+    checksum = std::uint64_t{acc};
+    return checksum;
+  })};
+  bench::report("  attacks::slider_attacks", n_queries * n_repeats, secs);
+  std::cout << "    checksum " << checksum << '\n';
+
+  return 0;
+}
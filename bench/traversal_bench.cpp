@@ -0,0 +1,84 @@
+#include "bench_utils.hpp"
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/perft.hpp"
+
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <string_view>
+using namespace mpham_chess;
+
+namespace {
+
+constexpr std::array<std::string_view, 4> bench_fens{
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1"};
+
+constexpr unsigned int bench_depth{5};
+constexpr std::size_t n_runs{3};
+
+template <bool bulk_count, traversal trav>
+[[nodiscard]] std::size_t perft_all_fens() noexcept {
+  std::size_t nodes{0};
+  for (const auto fen : bench_fens) {
+    board pos{fen};
+    nodes += perft_nodes<bulk_count, trav>(pos, bench_depth);
+  }
+  return nodes;
+}
+
+template <bool bulk_count> bool compare_traversals(const char *name) noexcept {
+  // best of `n_runs` over all bench positions, alternating the two policies
+  std::cout << name << '\n';
+
+  const auto nodes{perft_all_fens<bulk_count, traversal::make_unmake>()};
+  if (nodes != perft_all_fens<bulk_count, traversal::copy_make>()) {
+    std::cerr << "node count mismatch\n";
+    return false;
+  }
+
+  double make_unmake_secs{0.0}, copy_make_secs{0.0};
+  for (std::size_t run{0}; run < n_runs; run++) {
+    const auto [mu_nodes, mu_t]{bench::time_it([] {
+      return perft_all_fens<bulk_count, traversal::make_unmake>();
+    })};
+    const auto [cm_nodes, cm_t]{bench::time_it(
+        [] { return perft_all_fens<bulk_count, traversal::copy_make>(); })};
+    static_cast<void>(mu_nodes);
+    static_cast<void>(cm_nodes);
+    if (run == 0 || mu_t < make_unmake_secs) {
+      make_unmake_secs = mu_t;
+    }
+    if (run == 0 || cm_t < copy_make_secs) {
+      copy_make_secs = cm_t;
+    }
+  }
+
+  bench::report("  make/unmake", nodes, make_unmake_secs);
+  bench::report("  copy-make", nodes, copy_make_secs);
+  const auto copy_make_faster{copy_make_secs < make_unmake_secs};
+  std::cout << "  faster: " << (copy_make_faster ? "copy-make" : "make/unmake")
+            << " (x"
+            << (copy_make_faster ? make_unmake_secs / copy_make_secs
+                                 : copy_make_secs / make_unmake_secs)
+            << ")\n";
+  return true;
+}
+
+} // namespace
+
+int main() {
+  // make/unmake vs copy-make (sizeof(board) bytes copied per move)
+  std::cout << "sizeof(board): " << sizeof(board) << " bytes, depth "
+            << bench_depth << '\n';
+
+  if (!compare_traversals<false>("perft_nodes (leaf moves)") ||
+      !compare_traversals<true>("perft_nodes (bulk count)")) {
+    return 1;
+  }
+  return 0;
+}
@@ -6,11 +6,30 @@
 #include <cstddef>
 #include <initializer_list>
 #include <iterator>
+#include <memory>
+#include <type_traits>
 #include <utility>
 
 namespace detail {
 
-template <typename dtype, std::size_t n_max> class fixed_vector {
+template <typename value_type, std::size_t n_max>
+struct value_initialized_storage {
+  std::array<value_type, n_max> _arr{};
+};
+
+// (trivial types only) the elements are left uninitialized until they are
+// constructed in place, e.g. a move list declared at every perft node
+template <typename value_type, std::size_t n_max>
+struct uninitialized_storage {
+  union {
+    std::array<value_type, n_max> _arr;
+  };
+
+  constexpr uninitialized_storage() noexcept {}
+};
+
+template <typename dtype, std::size_t n_max, bool is_initialized = true>
+class fixed_vector {
 public:
   using value_type = dtype;
   using iterator = std::array<value_type, n_max>::iterator;
@@ -24,11 +43,19 @@ public:
   using const_pointer = std::array<value_type, n_max>::const_pointer;
 
 private:
-  std::array<value_type, n_max> _arr{};
+  static_assert(is_initialized ||
+                (std::is_trivially_copyable_v<value_type> &&
+                 std::is_trivially_destructible_v<value_type>));
+  using storage =
+      std::conditional_t<is_initialized,
+                         value_initialized_storage<value_type, n_max>,
+                         uninitialized_storage<value_type, n_max>>;
+
+  storage _storage{};
   std::size_t _count{0};
 
 public:
-  explicit constexpr fixed_vector() noexcept = default;
+  explicit constexpr fixed_vector() noexcept;
   explicit constexpr fixed_vector(
       std::size_t count, const value_type &value = value_type{}) noexcept;
   explicit constexpr fixed_vector(
@@ -63,152 +90,170 @@ public:
   constexpr void clear() noexcept;
   constexpr void resize(std::size_t count,
                         const value_type &value = value_type{}) noexcept;
-  constexpr void swap(fixed_vector<value_type, n_max> &rhs) noexcept;
+  constexpr void swap(fixed_vector &rhs) noexcept;
 
   [[nodiscard]] constexpr pointer data() noexcept;
   [[nodiscard]] constexpr const_pointer data() const noexcept;
 
   [[nodiscard]] constexpr iterator begin() noexcept;
   [[nodiscard]] constexpr iterator end() noexcept;
-  [[nodiscard]] constexpr iterator begin() const noexcept;
-  [[nodiscard]] constexpr iterator end() const noexcept;
+  [[nodiscard]] constexpr const_iterator begin() const noexcept;
+  [[nodiscard]] constexpr const_iterator end() const noexcept;
   [[nodiscard]] constexpr const_iterator cbegin() const noexcept;
   [[nodiscard]] constexpr const_iterator cend() const noexcept;
   [[nodiscard]] constexpr reverse_iterator rbegin() noexcept;
   [[nodiscard]] constexpr reverse_iterator rend() noexcept;
-  [[nodiscard]] constexpr reverse_iterator rbegin() const noexcept;
-  [[nodiscard]] constexpr reverse_iterator rend() const noexcept;
+  [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept;
+  [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept;
   [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept;
   [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept;
 };
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::fixed_vector(
+// (defaulted out of line, so `fixed_vector v{}` does not zero the storage)
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max,
+                       is_initialized>::fixed_vector() noexcept = default;
+
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::fixed_vector(
     std::size_t count, const value_type &value) noexcept
     : _count{count} {
   assert(_count <= n_max);
-  std::fill_n(_arr.begin(), count, value);
+  std::fill_n(_storage._arr.begin(), count, value);
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::fixed_vector(
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::fixed_vector(
     std::initializer_list<value_type> values) noexcept
     : _count{values.size()} {
   assert(_count <= n_max);
-  std::move(values.begin(), values.end(), _arr.begin());
+  std::move(values.begin(), values.end(), _storage._arr.begin());
 }
 
-template <typename value_type, std::size_t n_max>
+template <typename value_type, std::size_t n_max, bool is_initialized>
 template <typename input_iterator>
   requires(std::input_iterator<input_iterator>)
-constexpr fixed_vector<value_type, n_max>::fixed_vector(
+constexpr fixed_vector<value_type, n_max, is_initialized>::fixed_vector(
     input_iterator first_it, input_iterator last_it) noexcept
     : _count{static_cast<std::size_t>(std::distance(first_it, last_it))} {
   assert(_count <= n_max);
-  std::move(first_it, last_it, _arr.begin());
+  std::move(first_it, last_it, _storage._arr.begin());
 }
 
-template <typename value_type, std::size_t n_max>
+template <typename value_type, std::size_t n_max, bool is_initialized>
 template <typename... types>
-constexpr fixed_vector<value_type, n_max>::reference
-fixed_vector<value_type, n_max>::emplace_back(types &&...args) noexcept {
+constexpr fixed_vector<value_type, n_max, is_initialized>::reference
+fixed_vector<value_type, n_max, is_initialized>::emplace_back(
+    types &&...args) noexcept {
   assert(_count < n_max);
-  _arr[_count++] = value_type{std::forward<types>(args)...};
-  return _arr[_count];
+  if constexpr (is_initialized) {
+    _storage._arr[_count] = value_type{std::forward<types>(args)...};
+  } else {
+    std::construct_at(data() + _count, std::forward<types>(args)...);
+  }
+  return _storage._arr[_count++];
 }
 
-template <typename value_type, std::size_t n_max>
+template <typename value_type, std::size_t n_max, bool is_initialized>
 constexpr void
-fixed_vector<value_type, n_max>::push_back(const value_type &value) noexcept {
+fixed_vector<value_type, n_max, is_initialized>::push_back(
+    const value_type &value) noexcept {
   assert(_count < n_max);
-  _arr[_count++] = value;
+  _storage._arr[_count++] = value;
 }
 
-template <typename value_type, std::size_t n_max>
+template <typename value_type, std::size_t n_max, bool is_initialized>
 constexpr void
-fixed_vector<value_type, n_max>::push_back(value_type &&value) noexcept {
+fixed_vector<value_type, n_max, is_initialized>::push_back(
+    value_type &&value) noexcept {
   assert(_count < n_max);
-  _arr[_count++] = std::move(value);
+  _storage._arr[_count++] = std::move(value);
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr void fixed_vector<value_type, n_max>::pop_back() noexcept {
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr void
+fixed_vector<value_type, n_max, is_initialized>::pop_back() noexcept {
   assert(_count > 0);
   _count--;
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::reference
-fixed_vector<value_type, n_max>::operator[](std::size_t pos) noexcept {
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::reference
+fixed_vector<value_type, n_max, is_initialized>::operator[](
+    std::size_t pos) noexcept {
   assert(pos < _count);
-  return _arr[pos];
+  return _storage._arr[pos];
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::const_reference
-fixed_vector<value_type, n_max>::operator[](std::size_t pos) const noexcept {
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::const_reference
+fixed_vector<value_type, n_max, is_initialized>::operator[](
+    std::size_t pos) const noexcept {
   assert(pos < _count);
-  return _arr[pos];
+  return _storage._arr[pos];
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::reference
-fixed_vector<value_type, n_max>::front() noexcept {
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::reference
+fixed_vector<value_type, n_max, is_initialized>::front() noexcept {
   assert(_count > 0);
-  return _arr[0];
+  return _storage._arr[0];
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::const_reference
-fixed_vector<value_type, n_max>::front() const noexcept {
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::const_reference
+fixed_vector<value_type, n_max, is_initialized>::front() const noexcept {
   assert(_count > 0);
-  return _arr[0];
+  return _storage._arr[0];
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::reference
-fixed_vector<value_type, n_max>::back() noexcept {
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::reference
+fixed_vector<value_type, n_max, is_initialized>::back() noexcept {
   assert(0 < _count && _count <= n_max);
-  return _arr[_count - 1];
+  return _storage._arr[_count - 1];
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::const_reference
-fixed_vector<value_type, n_max>::back() const noexcept {
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::const_reference
+fixed_vector<value_type, n_max, is_initialized>::back() const noexcept {
   assert(0 < _count && _count <= n_max);
-  return _arr[_count - 1];
+  return _storage._arr[_count - 1];
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr std::size_t fixed_vector<value_type, n_max>::size() const noexcept {
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr std::size_t
+fixed_vector<value_type, n_max, is_initialized>::size() const noexcept {
   return _count;
 }
 
-template <typename value_type, std::size_t n_max>
+template <typename value_type, std::size_t n_max, bool is_initialized>
 constexpr std::size_t
-fixed_vector<value_type, n_max>::capacity() const noexcept {
+fixed_vector<value_type, n_max, is_initialized>::capacity() const noexcept {
   return n_max;
 }
 
-template <typename value_type, std::size_t n_max>
+template <typename value_type, std::size_t n_max, bool is_initialized>
 constexpr std::size_t
-fixed_vector<value_type, n_max>::max_size() const noexcept {
+fixed_vector<value_type, n_max, is_initialized>::max_size() const noexcept {
   return n_max;
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr bool fixed_vector<value_type, n_max>::empty() const noexcept {
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr bool
+fixed_vector<value_type, n_max, is_initialized>::empty() const noexcept {
   return _count == 0;
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr void fixed_vector<value_type, n_max>::clear() noexcept {
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr void
+fixed_vector<value_type, n_max, is_initialized>::clear() noexcept {
   _count = 0;
 }
 
-template <typename value_type, std::size_t n_max>
+template <typename value_type, std::size_t n_max, bool is_initialized>
 constexpr void
-fixed_vector<value_type, n_max>::resize(std::size_t count,
+fixed_vector<value_type, n_max, is_initialized>::resize(std::size_t count,
                                         const value_type &value) noexcept {
   assert(count <= n_max);
   if (count > _count) {
@@ -218,100 +263,104 @@ fixed_vector<value_type, n_max>::resize(std::size_t count,
   _count = count;
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr void fixed_vector<value_type, n_max>::swap(
-    fixed_vector<value_type, n_max> &rhs) noexcept {
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr void fixed_vector<value_type, n_max, is_initialized>::swap(
+    fixed_vector &rhs) noexcept {
   std::swap(*this, rhs);
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::pointer
-fixed_vector<value_type, n_max>::data() noexcept {
-  return _arr.data();
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::pointer
+fixed_vector<value_type, n_max, is_initialized>::data() noexcept {
+  return _storage._arr.data();
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::const_pointer
-fixed_vector<value_type, n_max>::data() const noexcept {
-  return _arr.data();
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::const_pointer
+fixed_vector<value_type, n_max, is_initialized>::data() const noexcept {
+  return _storage._arr.data();
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::iterator
-fixed_vector<value_type, n_max>::begin() noexcept {
-  return _arr.begin();
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::iterator
+fixed_vector<value_type, n_max, is_initialized>::begin() noexcept {
+  return _storage._arr.begin();
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::iterator
-fixed_vector<value_type, n_max>::end() noexcept {
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::iterator
+fixed_vector<value_type, n_max, is_initialized>::end() noexcept {
   assert(_count <= n_max);
-  return _arr.end() - (n_max - _count);
+  return _storage._arr.end() - (n_max - _count);
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::iterator
-fixed_vector<value_type, n_max>::begin() const noexcept {
-  return _arr.begin();
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::const_iterator
+fixed_vector<value_type, n_max, is_initialized>::begin() const noexcept {
+  return _storage._arr.begin();
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::iterator
-fixed_vector<value_type, n_max>::end() const noexcept {
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::const_iterator
+fixed_vector<value_type, n_max, is_initialized>::end() const noexcept {
   assert(_count <= n_max);
-  return _arr.end() - (n_max - _count);
+  return _storage._arr.end() - (n_max - _count);
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::const_iterator
-fixed_vector<value_type, n_max>::cbegin() const noexcept {
-  return _arr.cbegin();
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::const_iterator
+fixed_vector<value_type, n_max, is_initialized>::cbegin() const noexcept {
+  return _storage._arr.cbegin();
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::const_iterator
-fixed_vector<value_type, n_max>::cend() const noexcept {
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::const_iterator
+fixed_vector<value_type, n_max, is_initialized>::cend() const noexcept {
   assert(_count <= n_max);
-  return _arr.cend() - (n_max - _count);
+  return _storage._arr.cend() - (n_max - _count);
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::reverse_iterator
-fixed_vector<value_type, n_max>::rbegin() noexcept {
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::reverse_iterator
+fixed_vector<value_type, n_max, is_initialized>::rbegin() noexcept {
   assert(_count <= n_max);
-  return _arr.rbegin() + (n_max - _count);
+  return _storage._arr.rbegin() + (n_max - _count);
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::reverse_iterator
-fixed_vector<value_type, n_max>::rend() noexcept {
-  return _arr.rend();
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::reverse_iterator
+fixed_vector<value_type, n_max, is_initialized>::rend() noexcept {
+  return _storage._arr.rend();
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::reverse_iterator
-fixed_vector<value_type, n_max>::rbegin() const noexcept {
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::
+    const_reverse_iterator
+fixed_vector<value_type, n_max, is_initialized>::rbegin() const noexcept {
   assert(_count <= n_max);
-  return _arr.rbegin() + (n_max - _count);
+  return _storage._arr.rbegin() + (n_max - _count);
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::reverse_iterator
-fixed_vector<value_type, n_max>::rend() const noexcept {
-  return _arr.rend();
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::
+    const_reverse_iterator
+fixed_vector<value_type, n_max, is_initialized>::rend() const noexcept {
+  return _storage._arr.rend();
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::const_reverse_iterator
-fixed_vector<value_type, n_max>::crbegin() const noexcept {
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::
+    const_reverse_iterator
+fixed_vector<value_type, n_max, is_initialized>::crbegin() const noexcept {
   assert(_count <= n_max);
-  return _arr.crbegin() + (n_max - _count);
+  return _storage._arr.crbegin() + (n_max - _count);
 }
 
-template <typename value_type, std::size_t n_max>
-constexpr fixed_vector<value_type, n_max>::const_reverse_iterator
-fixed_vector<value_type, n_max>::crend() const noexcept {
-  return _arr.crend();
+template <typename value_type, std::size_t n_max, bool is_initialized>
+constexpr fixed_vector<value_type, n_max, is_initialized>::
+    const_reverse_iterator
+fixed_vector<value_type, n_max, is_initialized>::crend() const noexcept {
+  return _storage._arr.crend();
 }
 
 } // namespace detail
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace detail {
+
+class thread_pool {
+  // work-stealing thread pool
+  // https://en.wikipedia.org/wiki/Work_stealing
+  //
+  // Every worker owns a task queue. Tasks submitted from inside a worker are
+  // pushed onto that worker's own queue and popped LIFO (depth-first, cache
+  // friendly). Idle workers steal FIFO from the front of other workers' queues
+  // (i.e. the oldest and usually largest tasks). Tasks submitted from outside
+  // the pool are distributed round-robin.
+
+public:
+  using task = std::function<void(std::size_t worker_id)>;
+
+  static constexpr std::size_t no_worker{
+      std::numeric_limits<std::size_t>::max()};
+
+private:
+  struct task_queue {
+    std::mutex _mutex{};
+    std::deque<task> _tasks{};
+  };
+
+  std::vector<task_queue> _queues;
+  std::vector<std::jthread> _workers{};
+
+  std::mutex _sleep_mutex{};
+  std::condition_variable _wake_cv{};
+  std::condition_variable _done_cv{};
+
+  std::atomic<std::size_t> _n_queued{0};
+  std::atomic<std::size_t> _n_pending{0};
+  std::atomic<std::size_t> _n_idle{0};
+  std::atomic<std::size_t> _next_queue{0};
+  bool _stop{false};
+
+  static inline thread_local const thread_pool *_this_pool{nullptr};
+  static inline thread_local std::size_t _this_worker{no_worker};
+
+public:
+  [[nodiscard]] explicit thread_pool(std::size_t n_threads = 0) noexcept;
+  ~thread_pool() noexcept;
+
+  thread_pool(const thread_pool &pool) = delete;
+  thread_pool &operator=(const thread_pool &pool) = delete;
+
+  void submit(task t) noexcept;
+  void wait() noexcept;
+
+  [[nodiscard]] std::size_t size() const noexcept;
+  [[nodiscard]] bool has_idle_workers() const noexcept;
+
+private:
+  void worker_loop(std::size_t worker_id) noexcept;
+  [[nodiscard]] bool try_pop(std::size_t worker_id, task &t) noexcept;
+};
+
+inline thread_pool::thread_pool(std::size_t n_threads) noexcept
+    : _queues(std::max<std::size_t>(
+          1, (n_threads == 0) ? std::thread::hardware_concurrency()
+                              : n_threads)) {
+  _workers.reserve(_queues.size());
+  for (std::size_t worker_id{0}; worker_id < _queues.size(); worker_id++) {
+    _workers.emplace_back([this, worker_id] { worker_loop(worker_id); });
+  }
+}
+
+inline thread_pool::~thread_pool() noexcept {
+  wait();
+  {
+    std::lock_guard lock{_sleep_mutex};
+    _stop = true;
+  }
+  _wake_cv.notify_all();
+  _workers.clear();
+}
+
+inline void thread_pool::submit(task t) noexcept {
+  const auto queue_ind{
+      (_this_pool == this)
+          ? _this_worker
+          : _next_queue.fetch_add(1, std::memory_order_relaxed) %
+                _queues.size()};
+
+  // `_n_queued` / `_n_idle` are a store then load on each side (here and in
+  // `worker_loop`), only sequential consistency guarantees that either this
+  // thread sees the idle worker or the worker sees the queued task
+  _n_pending.fetch_add(1, std::memory_order_relaxed);
+  _n_queued.fetch_add(1, std::memory_order_seq_cst);
+  {
+    auto &queue{_queues[queue_ind]};
+    std::lock_guard lock{queue._mutex};
+    queue._tasks.push_back(std::move(t));
+  }
+
+  if (_n_idle.load(std::memory_order_seq_cst) > 0) {
+    // lock (and immediately release) so a worker cannot miss the wake up
+    // between checking for work and going to sleep
+    { std::lock_guard lock{_sleep_mutex}; }
+    _wake_cv.notify_one();
+  }
+}
+
+inline void thread_pool::wait() noexcept {
+  std::unique_lock lock{_sleep_mutex};
+  _done_cv.wait(lock, [this] {
+    return _n_pending.load(std::memory_order_acquire) == 0;
+  });
+}
+
+inline std::size_t thread_pool::size() const noexcept {
+  return _workers.size();
+}
+
+inline bool thread_pool::has_idle_workers() const noexcept {
+  return _n_idle.load(std::memory_order_relaxed) > 0 &&
+         _n_queued.load(std::memory_order_relaxed) == 0;
+}
+
+inline void thread_pool::worker_loop(std::size_t worker_id) noexcept {
+  _this_pool = this;
+  _this_worker = worker_id;
+
+  while (true) {
+    task t{};
+    if (try_pop(worker_id, t)) {
+      t(worker_id);
+      if (_n_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        { std::lock_guard lock{_sleep_mutex}; }
+        _done_cv.notify_all();
+      }
+      continue;
+    }
+
+    std::unique_lock lock{_sleep_mutex};
+    _n_idle.fetch_add(1, std::memory_order_seq_cst);
+    _wake_cv.wait(lock, [this] {
+      return _stop || _n_queued.load(std::memory_order_seq_cst) > 0;
+    });
+    _n_idle.fetch_sub(1, std::memory_order_release);
+    if (_stop && _n_queued.load(std::memory_order_acquire) == 0) {
+      return;
+    }
+  }
+}
+
+inline bool thread_pool::try_pop(std::size_t worker_id, task &t) noexcept {
+  if (_n_queued.load(std::memory_order_acquire) == 0) {
+    return false;
+  }
+
+  // own queue: newest task first
+  {
+    auto &queue{_queues[worker_id]};
+    std::lock_guard lock{queue._mutex};
+    if (!queue._tasks.empty()) {
+      t = std::move(queue._tasks.back());
+      queue._tasks.pop_back();
+      _n_queued.fetch_sub(1, std::memory_order_acq_rel);
+      return true;
+    }
+  }
+
+  // steal: oldest task first
+  for (std::size_t offset{1}; offset < _queues.size(); offset++) {
+    auto &queue{_queues[(worker_id + offset) % _queues.size()]};
+    std::lock_guard lock{queue._mutex};
+    if (!queue._tasks.empty()) {
+      t = std::move(queue._tasks.front());
+      queue._tasks.pop_front();
+      _n_queued.fetch_sub(1, std::memory_order_acq_rel);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+} // namespace detail
@@ -6,7 +6,11 @@
 #include "mpham_chess/rng.hpp"
 #include "mpham_chess/utils.hpp"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <utility>
+#include <vector>
 
 namespace mpham_chess::attacks {
 
@@ -53,10 +57,130 @@ slider_attacks(square slider,
 
 [[nodiscard]] constexpr bitboard inbetween_squares(square sq_1,
                                                    square sq_2) noexcept;
+[[nodiscard]] constexpr bitboard line_through(square sq_1,
+                                              square sq_2) noexcept;
 
 [[nodiscard]] constexpr unsigned int square_distances(square sq_1,
                                                       square sq_2) noexcept;
 
+template <color c> constexpr bitboard pawn_attacks(bitboard pawns) noexcept {
+  if constexpr (c == color::white) {
+    return shift<direction::NE>(pawns) | shift<direction::NW>(pawns);
+  } else {
+    return shift<direction::SE>(pawns) | shift<direction::SW>(pawns);
+  }
+}
+
+template <color c> constexpr bitboard pawn_attacks(square pawn) noexcept {
+  assert(pawn != square::no_square);
+
+  static constexpr auto pawn_atk_tbl = [] consteval {
+    pawn_attack_table pawn_atk_tbl{};
+
+    for (auto sq_ind{0}; sq_ind < constants::n_squares; sq_ind++) {
+      const square sq{sq_ind};
+      const bitboard sq_bb{sq};
+
+      pawn_atk_tbl[std::to_underlying(color::white)][sq_ind] =
+          pawn_attacks<color::white>(sq_bb);
+      pawn_atk_tbl[std::to_underlying(color::black)][sq_ind] =
+          pawn_attacks<color::black>(sq_bb);
+    }
+
+    return pawn_atk_tbl;
+  }();
+
+  return pawn_atk_tbl[std::to_underlying(c)][std::to_underlying(pawn)];
+}
+
+constexpr bitboard knight_attacks(bitboard knights) noexcept {
+  // TODO : 8-shift vs shift + mirror
+  return shift<direction::NNE>(knights) | shift<direction::NEE>(knights) |
+         shift<direction::SEE>(knights) | shift<direction::SSE>(knights) |
+         shift<direction::SSW>(knights) | shift<direction::SWW>(knights) |
+         shift<direction::NWW>(knights) | shift<direction::NNW>(knights);
+}
+
+constexpr bitboard knight_attacks(square knight) noexcept {
+  assert(knight != square::no_square);
+
+  static constexpr auto knight_atk_tbl = [] consteval {
+    attack_table knight_atk_tbl{};
+
+    for (auto sq_ind{0}; sq_ind < constants::n_squares; sq_ind++) {
+      const square sq{sq_ind};
+      const bitboard sq_bb{sq};
+
+      knight_atk_tbl[sq_ind] = knight_attacks(sq_bb);
+    }
+
+    return knight_atk_tbl;
+  }();
+
+  return knight_atk_tbl[std::to_underlying(knight)];
+}
+
+constexpr bitboard king_attacks(bitboard kings) noexcept {
+  // TODO : 8-shift vs shift + mirror
+  return shift<direction::N>(kings) | shift<direction::E>(kings) |
+         shift<direction::S>(kings) | shift<direction::W>(kings) |
+         shift<direction::NE>(kings) | shift<direction::SE>(kings) |
+         shift<direction::SW>(kings) | shift<direction::NW>(kings);
+}
+
+constexpr bitboard king_attacks(square king) noexcept {
+  assert(king != square::no_square);
+
+  static constexpr auto king_atk_tbl = [] consteval {
+    attack_table king_atk_tbl{};
+
+    for (auto sq_ind{0}; sq_ind < constants::n_squares; sq_ind++) {
+      const square sq{sq_ind};
+      const bitboard sq_bb{sq};
+
+      king_atk_tbl[sq_ind] = king_attacks(sq_bb);
+    }
+
+    return king_atk_tbl;
+  }();
+
+  return king_atk_tbl[std::to_underlying(king)];
+}
+
+template <direction dir>
+  requires ray_dir<dir>
+constexpr bitboard ray_attacks(bitboard origins, bitboard blockers) noexcept {
+  origins.fill<dir>(blockers);
+  return origins.shift<dir>();
+}
+
+template <piece_type pt>
+  requires slider_pt<pt>
+constexpr bitboard slider_attacks(bitboard sliders,
+                                  bitboard blockers) noexcept {
+  if constexpr (pt == piece_type::bishop) {
+    return ray_attacks<direction::NE>(sliders, blockers) |
+           ray_attacks<direction::SE>(sliders, blockers) |
+           ray_attacks<direction::SW>(sliders, blockers) |
+           ray_attacks<direction::NW>(sliders, blockers);
+  } else if constexpr (pt == piece_type::rook) {
+    return ray_attacks<direction::N>(sliders, blockers) |
+           ray_attacks<direction::E>(sliders, blockers) |
+           ray_attacks<direction::S>(sliders, blockers) |
+           ray_attacks<direction::W>(sliders, blockers);
+  } else if constexpr (pt == piece_type::queen) {
+    return slider_attacks<piece_type::bishop>(sliders, blockers) |
+           slider_attacks<piece_type::rook>(sliders, blockers);
+  }
+}
+
+template <>
+inline bitboard slider_attacks<piece_type::queen>(square slider,
+                                                  bitboard blockers) noexcept {
+  return slider_attacks<piece_type::bishop>(slider, blockers) |
+         slider_attacks<piece_type::rook>(slider, blockers);
+}
+
 namespace magics {
 // good explanation of magic bitboards
 // https://analog-hors.github.io/site/magic-bitboards
@@ -99,6 +223,21 @@ namespace magics {
 // even smaller if optimized magics (constructive collisions) are found.
 // `Table_offset` is used to index the correct square table when using
 // `fancy magic bitboards`.
+//
+// On BMI2 hardware `pext(blockers, relevant_blockers)` maps every blocker
+// subset to a dense key in [0, 2^(number of relevant blocker squares))
+// without any magic number, so the same (fancy) table layout can be indexed
+// with a single instruction instead of a multiply and shift. The lookup is
+// selected at compile time with `MPHAM_CHESS_USE_PEXT` (CMake `USE_PEXT`).
+
+#if defined(MPHAM_CHESS_USE_PEXT)
+#if !defined(__BMI2__)
+#error "MPHAM_CHESS_USE_PEXT requires BMI2 (e.g. -mbmi2)"
+#endif
+inline constexpr slider_lookup default_slider_lookup{slider_lookup::pext};
+#else
+inline constexpr slider_lookup default_slider_lookup{slider_lookup::magic};
+#endif
 
 struct magic_entry {
   bitboard _relevant_blockers{constants::bb::empty};
@@ -106,15 +245,40 @@ struct magic_entry {
   unsigned int _table_offset{0};
   unsigned int _key_shift{0};
 
-  [[nodiscard]] inline std::size_t
+  template <slider_lookup lookup = default_slider_lookup>
+  [[nodiscard]] constexpr std::size_t
+  get_square_key(bitboard blockers) const noexcept {
+    // key into this square's slice of the attack table
+    if constexpr (lookup == slider_lookup::pext) {
+      return std::size_t{blockers.pext(_relevant_blockers)};
+    } else {
+      blockers &= _relevant_blockers;
+      return std::size_t{(_magic * blockers) >> _key_shift};
+    }
+  }
+
+  template <slider_lookup lookup = default_slider_lookup>
+  [[nodiscard]] constexpr std::size_t
   get_attack_table_key(bitboard blockers) const noexcept {
-    blockers &= _relevant_blockers;
-    const auto hash_key{(_magic * blockers) >> _key_shift};
-    return std::size_t{hash_key + _table_offset};
+    return get_square_key<lookup>(blockers) + _table_offset;
   }
 };
 using magics_table = std::array<magic_entry, constants::n_squares>;
 
+// Lookup entry: a square's magic entry together with the base of its slice
+// of the attack table, so a lookup only touches one entry (half a cache line)
+// and the table slice.
+struct alignas(32) slider_entry {
+  magic_entry _magic_entry{};
+  const bitboard *_attacks{nullptr};
+
+  template <slider_lookup lookup = default_slider_lookup>
+  [[nodiscard]] bitboard get_attacks(bitboard blockers) const noexcept {
+    return _attacks[_magic_entry.get_square_key<lookup>(blockers)];
+  }
+};
+using slider_entries_table = std::array<slider_entry, constants::n_squares>;
+
 template <piece_type pt>
   requires slider_pt<pt>
 [[nodiscard]] constexpr bitboard relevant_blocker_mask(square sq) noexcept;
@@ -126,7 +290,67 @@ find_magic(square sq, rng::xorshift64 &rng = rng::main_rng) noexcept;
 
 template <piece_type pt>
   requires(pt == piece_type::bishop || pt == piece_type::rook)
-[[nodiscard]] magic_entry get_slider_magic(square sq) noexcept;
+[[nodiscard]] consteval magics_table make_magics_table() noexcept;
+
+template <piece_type pt>
+  requires(pt == piece_type::bishop || pt == piece_type::rook)
+[[nodiscard]] constexpr magic_entry get_slider_magic(square sq) noexcept;
+
+// Magic numbers found with `find_magic` using a default-seeded
+// `rng::xorshift64` (one generator per piece type), a1 to h8.
+// Hard-coding them keeps the tables deterministic and avoids searching
+// for magics at startup.
+inline constexpr std::array<std::uint64_t, constants::n_squares> bishop_magics{
+    0x0041020809090010ull, 0x20080b1414224192ull, 0x4014110409004010ull,
+    0x0084052200400000ull, 0x0202021000010142ull, 0x0001101804001110ull,
+    0x00a1110820241000ull, 0x2041004202201240ull, 0x0020902182108200ull,
+    0x0008020802440441ull, 0x1482108400414000ull, 0x000504041180c001ull,
+    0x0080940420300000ull, 0x9402491016300000ull, 0x0500050182104021ull,
+    0x0004020244122808ull, 0x0810014003980108ull, 0x2049200210140084ull,
+    0x08100020c5026020ull, 0x0028028088210100ull, 0x1608100501400500ull,
+    0x1009002200a18400ull, 0x0400401208044408ull, 0x0008250880841050ull,
+    0x8020090024304480ull, 0x00112012106c0120ull, 0x4001404108120040ull,
+    0xe80108000c004010ull, 0x0030101041004000ull, 0x0040ea0001018200ull,
+    0xa040840000840420ull, 0x0801030000404828ull, 0x08090410004010b1ull,
+    0x0042500480260800ull, 0x00840402000b0200ull, 0x2004200800010051ull,
+    0x0200420020020080ull, 0x0402900100888482ull, 0x00c2009400010c00ull,
+    0x0008090040410040ull, 0x05080422a0000800ull, 0x8902021a3e502000ull,
+    0x0a00140201000802ull, 0x1110004010400201ull, 0x8800210122020400ull,
+    0x00080a0802004058ull, 0x8020440282200092ull, 0x80010e2200404210ull,
+    0x04a4020805240101ull, 0x4101034210240000ull, 0x0001108400880004ull,
+    0x00a3080094040804ull, 0x01141020a4240c40ull, 0x00020c8810110008ull,
+    0x0018200480820000ull, 0x06b0822811032024ull, 0x000a0104010406c0ull,
+    0x000200a908061003ull, 0x4005100200840440ull, 0x009ac00000420200ull,
+    0x0450001054104404ull, 0x009600d420040108ull, 0x0004400808093040ull,
+    0x842c3f0405120a00ull};
+
+inline constexpr std::array<std::uint64_t, constants::n_squares> rook_magics{
+    0x808000c000108023ull, 0x0040200410004002ull, 0x4200083020408200ull,
+    0x0100201000982500ull, 0x01800aa800804400ull, 0x0a00090402001810ull,
+    0x8400009011020408ull, 0x5200004828840601ull, 0x000080003e400080ull,
+    0x000d004001002180ull, 0x3402001060820440ull, 0x0000801000800801ull,
+    0x0c0200240a003020ull, 0xc002000410080200ull, 0x0102000200e40108ull,
+    0x088500004200b100ull, 0x00008a800420400aull, 0x4010004000600040ull,
+    0x0080820026003040ull, 0x2084808008001001ull, 0x0002808004000801ull,
+    0x0020808004000200ull, 0x0080808002000100ull, 0x2020020001019044ull,
+    0x1180004540002002ull, 0x0033400100208108ull, 0x2981401500200104ull,
+    0x4890900080800800ull, 0x00000d0100280030ull, 0x0002004200288490ull,
+    0x1012000200010ce8ull, 0x8089002300008042ull, 0x0002804000800030ull,
+    0x820aa00684804000ull, 0x9441003041002000ull, 0x0000290021001001ull,
+    0x100100080100100cull, 0x0000204008011004ull, 0x0021082104000230ull,
+    0x0000149c02002041ull, 0x0008609240028000ull, 0x0090024020004000ull,
+    0x0904100020008080ull, 0x0a020012400a0020ull, 0x0028001500490010ull,
+    0x0001006400490002ull, 0x0201120004010100ull, 0x00c1b86400820001ull,
+    0x4320800240106080ull, 0x0502044308208200ull, 0x0421801020420200ull,
+    0x3408080080100680ull, 0x0022880004008080ull, 0x6002000814901600ull,
+    0x0405001a000c0100ull, 0x20204400cd00a200ull, 0x0380c0800020f101ull,
+    0x0400610040028011ull, 0x0002421108802202ull, 0x1000100100182005ull,
+    0x1002006128101402ull, 0x0001000c00021801ull, 0x4000190810520094ull,
+    0x1000022104184082ull};
+
+template <piece_type pt, slider_lookup lookup = default_slider_lookup>
+  requires(pt == piece_type::bishop || pt == piece_type::rook)
+[[nodiscard]] std::vector<bitboard> make_slider_attack_table() noexcept;
 
 template <piece_type pt>
   requires slider_pt<pt>
@@ -220,199 +444,127 @@ magic_entry find_magic(square sq, rng::xorshift64 &rng) noexcept {
 
 template <piece_type pt>
   requires(pt == piece_type::bishop || pt == piece_type::rook)
-magic_entry get_slider_magic(square sq) noexcept {
-  assert(sq != square::no_square);
-
-  static const auto magic_tbl = [] {
-    magics_table magic_tbl{};
-
-    auto offset{0};
-    for (auto sq_ind{0}; sq_ind < constants::n_squares; sq_ind++) {
-      const square sq{sq_ind};
-
-      auto slider_magic_entry{find_magic<pt>(sq)};
-
-      const auto key_size{UINT64_WIDTH - slider_magic_entry._key_shift};
-      const auto sq_atk_tbl_size{1 << key_size};
-
-      slider_magic_entry._table_offset = offset;
-      offset += sq_atk_tbl_size;
-
-      magic_tbl[sq_ind] = slider_magic_entry;
-    }
-
-    return magic_tbl;
-  }();
-
-  return magic_tbl[std::to_underlying(sq)];
-}
-
-} // namespace magics
-
-template <color c> constexpr bitboard pawn_attacks(bitboard pawns) noexcept {
-  if constexpr (c == color::white) {
-    return shift<direction::NE>(pawns) | shift<direction::NW>(pawns);
-  } else {
-    return shift<direction::SE>(pawns) | shift<direction::SW>(pawns);
+consteval magics_table make_magics_table() noexcept {
+  magics_table magic_tbl{};
+
+  unsigned int offset{0};
+  for (auto sq_ind{0}; sq_ind < constants::n_squares; sq_ind++) {
+    const square sq{sq_ind};
+
+    const auto relevant_blockers{relevant_blocker_mask<pt>(sq)};
+    const auto n_blockers{relevant_blockers.bit_count()};
+    const auto magic{(pt == piece_type::bishop) ? bishop_magics[sq_ind]
+                                                : rook_magics[sq_ind]};
+
+    magic_tbl[sq_ind] = magic_entry{._relevant_blockers = relevant_blockers,
+                                    ._magic = bitboard{magic},
+                                    ._table_offset = offset,
+                                    ._key_shift = UINT64_WIDTH - n_blockers};
+    offset += 1u << n_blockers;
   }
-}
-
-template <color c> constexpr bitboard pawn_attacks(square pawn) noexcept {
-  assert(pawn != square::no_square);
-
-  static constexpr auto pawn_atk_tbl = [] consteval {
-    pawn_attack_table pawn_atk_tbl{};
-
-    for (auto sq_ind{0}; sq_ind < constants::n_squares; sq_ind++) {
-      const square sq{sq_ind};
-      const bitboard sq_bb{sq};
-
-      pawn_atk_tbl[std::to_underlying(color::white)][sq_ind] =
-          pawn_attacks<color::white>(sq_bb);
-      pawn_atk_tbl[std::to_underlying(color::black)][sq_ind] =
-          pawn_attacks<color::black>(sq_bb);
-    }
 
-    return pawn_atk_tbl;
-  }();
-
-  return pawn_atk_tbl[std::to_underlying(c)][std::to_underlying(pawn)];
+  return magic_tbl;
 }
 
-constexpr bitboard knight_attacks(bitboard knights) noexcept {
-  // TODO : 8-shift vs shift + mirror
-  return shift<direction::NNE>(knights) | shift<direction::NEE>(knights) |
-         shift<direction::SEE>(knights) | shift<direction::SSE>(knights) |
-         shift<direction::SSW>(knights) | shift<direction::SWW>(knights) |
-         shift<direction::NWW>(knights) | shift<direction::NNW>(knights);
-}
-
-constexpr bitboard knight_attacks(square knight) noexcept {
-  assert(knight != square::no_square);
+template <piece_type pt>
+  requires(pt == piece_type::bishop || pt == piece_type::rook)
+inline constexpr magics_table slider_magics{make_magics_table<pt>()};
 
-  static constexpr auto knight_atk_tbl = [] consteval {
-    attack_table knight_atk_tbl{};
+template <piece_type pt>
+  requires(pt == piece_type::bishop || pt == piece_type::rook)
+inline constexpr std::size_t slider_attack_table_size{
+    slider_magics<pt>.back()._table_offset +
+    (std::size_t{1} << (UINT64_WIDTH - slider_magics<pt>.back()._key_shift))};
 
-    for (auto sq_ind{0}; sq_ind < constants::n_squares; sq_ind++) {
-      const square sq{sq_ind};
-      const bitboard sq_bb{sq};
+template <piece_type pt>
+  requires(pt == piece_type::bishop || pt == piece_type::rook)
+using slider_attack_table =
+    std::array<bitboard, slider_attack_table_size<pt>>;
+
+// The populated attack tables are too large to evaluate as constant
+// expressions in every translation unit, so they are generated at build time
+// by `gen_slider_attack_tables` (from `make_slider_attack_table`) and
+// constant-initialized in the generated `slider_attack_tables.cpp`.
+alignas(64) extern const slider_attack_table<piece_type::bishop>
+    bishop_attack_table;
+alignas(64) extern const slider_attack_table<piece_type::rook>
+    rook_attack_table;
 
-      knight_atk_tbl[sq_ind] = knight_attacks(sq_bb);
+template <piece_type pt>
+  requires(pt == piece_type::bishop || pt == piece_type::rook)
+[[nodiscard]] consteval slider_entries_table make_slider_entries() noexcept {
+  const auto &attack_tbl{[]() -> const auto & {
+    if constexpr (pt == piece_type::bishop) {
+      return bishop_attack_table;
+    } else {
+      return rook_attack_table;
     }
+  }()};
 
-    return knight_atk_tbl;
-  }();
-
-  return knight_atk_tbl[std::to_underlying(knight)];
-}
-
-constexpr bitboard king_attacks(bitboard kings) noexcept {
-  // TODO : 8-shift vs shift + mirror
-  return shift<direction::N>(kings) | shift<direction::E>(kings) |
-         shift<direction::S>(kings) | shift<direction::W>(kings) |
-         shift<direction::NE>(kings) | shift<direction::SE>(kings) |
-         shift<direction::SW>(kings) | shift<direction::NW>(kings);
+  slider_entries_table slider_entries{};
+  for (auto sq_ind{0}; sq_ind < constants::n_squares; sq_ind++) {
+    const auto &magic{slider_magics<pt>[sq_ind]};
+    slider_entries[sq_ind] = slider_entry{
+        ._magic_entry = magic, ._attacks = &attack_tbl[magic._table_offset]};
+  }
+  return slider_entries;
 }
 
-constexpr bitboard king_attacks(square king) noexcept {
-  assert(king != square::no_square);
+// eagerly (constant) initialized, cache line aligned lookup entries
+template <piece_type pt>
+  requires(pt == piece_type::bishop || pt == piece_type::rook)
+alignas(64) inline constexpr slider_entries_table slider_entries{
+    make_slider_entries<pt>()};
 
-  static constexpr auto king_atk_tbl = [] consteval {
-    attack_table king_atk_tbl{};
+template <piece_type pt>
+  requires(pt == piece_type::bishop || pt == piece_type::rook)
+constexpr magic_entry get_slider_magic(square sq) noexcept {
+  assert(sq != square::no_square);
+  return slider_magics<pt>[std::to_underlying(sq)];
+}
 
-    for (auto sq_ind{0}; sq_ind < constants::n_squares; sq_ind++) {
-      const square sq{sq_ind};
-      const bitboard sq_bb{sq};
+template <piece_type pt, slider_lookup lookup>
+  requires(pt == piece_type::bishop || pt == piece_type::rook)
+std::vector<bitboard> make_slider_attack_table() noexcept {
+  std::vector<bitboard> slider_atk_tbl(slider_attack_table_size<pt>,
+                                       constants::bb::empty);
 
-      king_atk_tbl[sq_ind] = king_attacks(sq_bb);
-    }
+  for (auto sq_ind{0}; sq_ind < constants::n_squares; sq_ind++) {
+    const square sq{sq_ind};
+    const bitboard sq_bb{sq};
 
-    return king_atk_tbl;
-  }();
+    const auto magic{get_slider_magic<pt>(sq)};
+    const auto relevant_blockers{magic._relevant_blockers};
 
-  return king_atk_tbl[std::to_underlying(king)];
-}
+    auto block_subset{constants::bb::empty};
+    do {
+      // Carry-Rippler subet traversal
+      // iterating over all possible subsets of `relevant_blockers`
+      block_subset = (block_subset - relevant_blockers) & relevant_blockers;
 
-template <direction dir>
-  requires ray_dir<dir>
-constexpr bitboard ray_attacks(bitboard origins, bitboard blockers) noexcept {
-  origins.fill<dir>(blockers);
-  return origins.shift<dir>();
-}
+      const auto key{magic.template get_attack_table_key<lookup>(block_subset)};
+      const auto attack_subset{slider_attacks<pt>(sq_bb, block_subset)};
 
-template <piece_type pt>
-  requires slider_pt<pt>
-constexpr bitboard slider_attacks(bitboard sliders,
-                                  bitboard blockers) noexcept {
-  if constexpr (pt == piece_type::bishop) {
-    return ray_attacks<direction::NE>(sliders, blockers) |
-           ray_attacks<direction::SE>(sliders, blockers) |
-           ray_attacks<direction::SW>(sliders, blockers) |
-           ray_attacks<direction::NW>(sliders, blockers);
-  } else if constexpr (pt == piece_type::rook) {
-    return ray_attacks<direction::N>(sliders, blockers) |
-           ray_attacks<direction::E>(sliders, blockers) |
-           ray_attacks<direction::S>(sliders, blockers) |
-           ray_attacks<direction::W>(sliders, blockers);
-  } else if constexpr (pt == piece_type::queen) {
-    return slider_attacks<piece_type::bishop>(sliders, blockers) |
-           slider_attacks<piece_type::rook>(sliders, blockers);
+      // slider attacks are never empty, so an occupied entry holding a
+      // different attack set means the magic is invalid
+      assert(slider_atk_tbl[key] == constants::bb::empty ||
+             slider_atk_tbl[key] == attack_subset);
+      slider_atk_tbl[key] = attack_subset;
+    } while (!block_subset.is_empty());
   }
-}
 
-template <>
-inline bitboard slider_attacks<piece_type::queen>(square slider,
-                                                  bitboard blockers) noexcept {
-  return slider_attacks<piece_type::bishop>(slider, blockers) |
-         slider_attacks<piece_type::rook>(slider, blockers);
+  return slider_atk_tbl;
 }
 
+} // namespace magics
+
 template <piece_type pt>
   requires slider_pt<pt>
 inline bitboard slider_attacks(square slider, bitboard blockers) noexcept {
   assert(slider != square::no_square);
 
-  static const auto slider_atk_tbl = [] {
-    std::vector<bitboard> slider_atk_tbl{};
-
-    auto tbl_size{0};
-    for (auto sq_ind{0}; sq_ind < constants::n_squares; sq_ind++) {
-      const square sq{sq_ind};
-      const bitboard sq_bb{sq};
-
-      const auto magic{magics::get_slider_magic<pt>(sq)};
-      const auto sq_key_size{UINT64_WIDTH - magic._key_shift};
-      const auto sq_atk_tbl_size{1 << sq_key_size};
-
-      tbl_size += sq_atk_tbl_size;
-    }
-    slider_atk_tbl.resize(tbl_size);
-
-    for (auto sq_ind{0}; sq_ind < constants::n_squares; sq_ind++) {
-      const square sq{sq_ind};
-      const bitboard sq_bb{sq};
-
-      const auto magic{magics::get_slider_magic<pt>(sq)};
-      const auto relevant_blockers{magic._relevant_blockers};
-
-      auto block_subset{constants::bb::empty};
-      do {
-        // Carry-Rippler subet traversal
-        // iterating over all possible subsets of `relevant_blockers`
-        block_subset = (block_subset - relevant_blockers) & relevant_blockers;
-
-        const auto key{magic.get_attack_table_key(block_subset)};
-        slider_atk_tbl[key] = slider_attacks<pt>(sq_bb, block_subset);
-      } while (!block_subset.is_empty());
-    }
-
-    assert(slider_atk_tbl.size() == slider_atk_tbl.capacity());
-    return slider_atk_tbl;
-  }();
-
-  const auto magic{magics::get_slider_magic<pt>(slider)};
-  const auto key{magic.get_attack_table_key(blockers)};
-  return slider_atk_tbl[key];
+  return magics::slider_entries<pt>[std::to_underlying(slider)].get_attacks(
+      blockers);
 }
 
 constexpr bitboard inbetween_squares(square sq_1, square sq_2) noexcept {
@@ -457,6 +609,49 @@ constexpr bitboard inbetween_squares(square sq_1, square sq_2) noexcept {
   return inbetween_squares[std::to_underlying(sq_1)][std::to_underlying(sq_2)];
 }
 
+constexpr bitboard line_through(square sq_1, square sq_2) noexcept {
+  // full board line (rank, file or diagonal) through both squares
+  // (empty if the squares are not aligned)
+  assert(sq_1 != square::no_square && sq_2 != square::no_square);
+
+  static constexpr auto line_through_tbl = [] consteval {
+    two_dim_square_table<bitboard> line_through{};
+
+    for (auto sq_ind_1{0}; sq_ind_1 < constants::n_squares; sq_ind_1++) {
+      const square sq_1{sq_ind_1};
+      const bitboard sq_bb_1{sq_1};
+
+      for (auto sq_ind_2{sq_ind_1 + 1}; sq_ind_2 < constants::n_squares;
+           sq_ind_2++) {
+        const square sq_2{sq_ind_2};
+        const bitboard sq_bb_2{sq_2};
+
+        const auto bishop_1{slider_attacks<piece_type::bishop>(sq_bb_1)};
+        const auto rook_1{slider_attacks<piece_type::rook>(sq_bb_1)};
+        const auto bishop_2{slider_attacks<piece_type::bishop>(sq_bb_2)};
+        const auto rook_2{slider_attacks<piece_type::rook>(sq_bb_2)};
+
+        const bool is_same_diag{bishop_1 & sq_bb_2};
+        const auto diag_line{(is_same_diag)
+                                 ? (bishop_1 & bishop_2) | sq_bb_1 | sq_bb_2
+                                 : constants::bb::empty};
+
+        const bool is_same_rowcol{rook_1 & sq_bb_2};
+        const auto rowcol_line{(is_same_rowcol)
+                                   ? (rook_1 & rook_2) | sq_bb_1 | sq_bb_2
+                                   : constants::bb::empty};
+
+        line_through[sq_ind_1][sq_ind_2] = diag_line | rowcol_line;
+        line_through[sq_ind_2][sq_ind_1] = line_through[sq_ind_1][sq_ind_2];
+      }
+    }
+
+    return line_through;
+  }();
+
+  return line_through_tbl[std::to_underlying(sq_1)][std::to_underlying(sq_2)];
+}
+
 constexpr unsigned int square_distances(square sq_1, square sq_2) noexcept {
   assert(sq_1 != square::no_square && sq_2 != square::no_square);
 
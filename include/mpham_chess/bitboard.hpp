@@ -9,6 +9,10 @@
 #include <ostream>
 #include <utility>
 
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
 namespace mpham_chess {
 
 class bitboard {
@@ -33,6 +37,7 @@ public:
 
   [[nodiscard]] constexpr bool is_empty() const noexcept;
   [[nodiscard]] constexpr unsigned int bit_count() const noexcept;
+  [[nodiscard]] constexpr bitboard pext(bitboard mask) const noexcept;
 
   template <typename sq_t>
     requires(std::constructible_from<sq_t, square>)
@@ -193,6 +198,24 @@ constexpr unsigned int bitboard::bit_count() const noexcept {
   return std::popcount(_bb);
 }
 
+constexpr bitboard bitboard::pext(bitboard mask) const noexcept {
+  // parallel bits extract: packs the bits selected by `mask` into the low bits
+#if defined(__BMI2__)
+  if !consteval {
+    return bitboard{_pext_u64(_bb, mask._bb)};
+  }
+#endif
+
+  std::uint64_t extracted{0};
+  for (std::uint64_t bit{1}; mask._bb != 0; bit <<= 1) {
+    if (_bb & mask._bb & -mask._bb) {
+      extracted |= bit;
+    }
+    mask._bb &= mask._bb - 1;
+  }
+  return bitboard{extracted};
+}
+
 template <typename sq_t>
   requires(std::constructible_from<sq_t, square>)
 constexpr sq_t bitboard::get_lsb() const noexcept {
@@ -11,12 +11,31 @@
 
 #include <array>
 #include <concepts>
+#include <cstdint>
 #include <ostream>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 
 namespace mpham_chess {
 
+// Check related bitboards of a position, computed on the first query after a
+// move (leaf positions never need them) and then read by every later query:
+//   * `_checkers`: enemy pieces giving check to the side to move
+//   * `_king_blockers`: pieces (of either color) that are the only blocker
+//     between the king of the indexed color and an enemy slider, i.e. pinned
+//     pieces and discovered check candidates
+//   * `_check_sqs`: squares a piece of the indexed type of the side to move
+//     would give check from
+struct check_info {
+  bitboard _checkers{constants::bb::empty};
+  std::array<bitboard, constants::n_colors> _king_blockers{};
+  std::array<bitboard, constants::n_piece_types> _check_sqs{};
+};
+
+// state that can not be recovered from a move when undoing it
+// (filled by `board::do_move`, consumed by `board::undo_move`)
 struct state_info {
   zobrist_hash _hash{0};
   unsigned int _rule50{0};
@@ -25,8 +44,57 @@ struct state_info {
   castle_rights _castle{castle_rights::no_castle};
 };
 
-using state_history = detail::fixed_vector<state_info, constants::max_ply>;
-using move_history = detail::fixed_vector<move, constants::max_ply>;
+struct undo_info {
+  move _move{};
+  state_info _state{};
+};
+
+// The move history is not part of `board` (which stays small and trivially
+// copyable). Callers that undo moves keep the `state_info`s themselves, e.g.
+// on the call stack or in a (per-thread) `undo_stack`.
+using undo_stack = detail::fixed_vector<undo_info, constants::max_ply>;
+
+// Per color attack maps (attacked squares and the number of attackers of
+// every square) kept up to date by the piece updates instead of being
+// recomputed on each query. Selected at compile time with
+// `MPHAM_CHESS_USE_ATTACK_MAPS` (CMake `USE_ATTACK_MAPS`).
+#if defined(MPHAM_CHESS_USE_ATTACK_MAPS)
+inline constexpr bool use_attack_maps{true};
+#else
+inline constexpr bool use_attack_maps{false};
+#endif
+
+using attacker_counts =
+    std::array<std::array<std::uint8_t, constants::n_squares>,
+               constants::n_colors>;
+
+using fen_buffer = std::array<char, constants::max_fen_length>;
+
+// Fixed size binary encoding of a position (e.g. for training data, opening
+// indices or position caches), written by `board::pack` and read back by
+// `board::unpack`:
+//   * `_occupied`: the occupied squares
+//   * `_pieces`: one nibble (the `piece`) per occupied square in square order,
+//     the first one in the low nibble of the first byte
+//   * `_castle_rook_files`: one nibble per color and castle side (white king
+//     side in the lowest), the file of the castle rook or `no_castle_file`
+//   * `_ep_sq`: the enpassant square (`square::no_square` if none)
+struct packed_board {
+  static constexpr std::uint8_t no_castle_file{0xF};
+
+  std::uint64_t _occupied{0};
+  std::array<std::uint8_t, 16> _pieces{};
+  std::uint16_t _castle_rook_files{0xFFFF};
+  std::uint8_t _side_to_move{0};
+  std::uint8_t _ep_sq{std::to_underlying(square::no_square)};
+  std::uint16_t _rule50{0};
+  std::uint16_t _movenum{0};
+
+  [[nodiscard]] bool operator==(const packed_board &) const noexcept = default;
+};
+
+static_assert(sizeof(packed_board) == 32);
+static_assert(std::is_trivially_copyable_v<packed_board>);
 
 using castle_king_squares = std::array<square, constants::n_colors>;
 using castle_rook_squares =
@@ -35,37 +103,62 @@ using castle_rook_squares =
 
 class board {
 private:
-  std::array<bitboard, constants::n_squares> _piece_bbs{};
+  // piece-type and color bitboards share one cache line (a piece's bitboard
+  // is the intersection of both), the mailbox fits in the next one
+  alignas(64) std::array<bitboard, constants::n_piece_types> _piece_type_bbs{};
   std::array<bitboard, constants::n_colors> _color_bbs{};
   std::array<piece, constants::n_squares> _piece_list{};
+#if defined(MPHAM_CHESS_USE_ATTACK_MAPS)
+  std::array<bitboard, constants::n_colors> _attacked_bbs{};
+  attacker_counts _attacker_counts{};
+#endif
 
   color _side_to_move{color::white};
   castle_rights _castle{castle_rights::no_castle};
   square _ep_sq{square::no_square};
   unsigned int _start_movenum{0};
+  unsigned int _ply{0};
   unsigned int _rule50{0};
   zobrist_hash _hash{0};
-  state_history _state_hist{};
-  move_history _move_hist{};
+  // secondary hashes, only changed by the piece updates (so restored by
+  // undoing them): pawns only, piece counts and the non-pawn pieces per color
+  zobrist_hash _pawn_hash{0};
+  zobrist_hash _material_hash{0};
+  std::array<zobrist_hash, constants::n_colors> _non_pawn_hashes{};
+  // Checkers and check info are computed on first use and cached here, so
+  // const queries (`get_checkers_bb`, `is_check`, `is_legal`, `gives_check`,
+  // `get_pinned_bb`, ...) write these members: a board, even a `const board&`,
+  // must not be queried from several threads at once. Give every thread (or
+  // pool task) its own copy of the position.
+  mutable check_info _check_info{};
+  mutable bool _has_checkers{false};
+  mutable bool _has_check_info{false};
 
   castle_king_squares _castle_king_sqs{square::no_square, square::no_square};
   castle_rook_squares _castle_rook_sqs{
       {{square::no_square, square::no_square},
        {square::no_square, square::no_square}}};
-  const bool _use_shredder_fen{false};
+  bool _use_shredder_fen{false};
 
 public:
   [[nodiscard]] explicit board(std::string_view fen = constants::start_pos_fen,
                                bool use_shredder_fen = false) noexcept;
-  board(const board &board) = delete;
-  board &operator=(const board &board) = delete;
+  [[nodiscard]] board(const board &board) noexcept = default;
+  board &operator=(const board &board) noexcept = default;
 
   void load_fen(std::string_view fen) noexcept;
   [[nodiscard]] std::string to_fen() const noexcept;
+  // (no allocation) the FEN is written into `buf`, returns the written part
+  [[nodiscard]] std::string_view write_fen(fen_buffer &buf) const noexcept;
+  // (the counters are saturated to 16 bits)
+  [[nodiscard]] packed_board pack() const noexcept;
+  void unpack(const packed_board &packed) noexcept;
   friend std::ostream &operator<<(std::ostream &os,
                                   const board &board) noexcept;
 
   [[nodiscard]] bitboard get_piece_bb(piece pc) const noexcept;
+  [[nodiscard]] bitboard get_piece_bb(color c, piece_type pt) const noexcept;
+  [[nodiscard]] bitboard get_piece_type_bb(piece_type pt) const noexcept;
   [[nodiscard]] bitboard get_color_bb(color c) const noexcept;
   [[nodiscard]] bitboard get_occupied_bb() const noexcept;
   [[nodiscard]] bitboard get_unoccupied_bb() const noexcept;
@@ -77,58 +170,107 @@ public:
   [[nodiscard]] unsigned int get_movenum() const noexcept;
   [[nodiscard]] unsigned int get_ply() const noexcept;
   [[nodiscard]] zobrist_hash get_hash() const noexcept;
+  [[nodiscard]] zobrist_hash get_pawn_hash() const noexcept;
+  [[nodiscard]] zobrist_hash get_material_hash() const noexcept;
+  [[nodiscard]] zobrist_hash get_non_pawn_hash(color c) const noexcept;
   [[nodiscard]] square get_king_castle_sq(color c) const noexcept;
   [[nodiscard]] square get_rook_castle_sq(color c,
                                           castle_side cs) const noexcept;
+  [[nodiscard]] bitboard get_checkers_bb() const noexcept;
+  [[nodiscard]] bitboard get_pinned_bb(color c) const noexcept;
+  [[nodiscard]] bitboard get_king_blockers_bb(color c) const noexcept;
+  [[nodiscard]] bitboard get_check_sqs_bb(piece_type pt) const noexcept;
+  [[nodiscard]] unsigned int get_n_attackers(color c,
+                                             square sq) const noexcept;
 
   template <bool use_side_to_move = true>
   [[nodiscard]] bool is_check() const noexcept;
+  [[nodiscard]] bool is_legal(move move) const noexcept;
+  [[nodiscard]] bool gives_check(move move) const noexcept;
+  [[nodiscard]] bool is_pseudo_legal(move move) const noexcept;
+  // `undo` holds the moves played to reach the position, the last `ply` of
+  // them since the root (e.g. of a search)
+  [[nodiscard]] bool is_repetition(const undo_stack &undo,
+                                   unsigned int ply) const noexcept;
+  [[nodiscard]] bool has_upcoming_repetition(const undo_stack &undo,
+                                             unsigned int ply) const noexcept;
   [[nodiscard]] bool is_sq_empty(square sq) const noexcept;
   [[nodiscard]] bool can_do_castle(color c, castle_side cs) const noexcept;
 
   template <typename sq_or_bb>
     requires(std::same_as<sq_or_bb, square> || std::same_as<sq_or_bb, bitboard>)
   [[nodiscard]] bitboard attacks_to(sq_or_bb targets) const noexcept;
+  template <typename sq_or_bb>
+    requires(std::same_as<sq_or_bb, square> || std::same_as<sq_or_bb, bitboard>)
+  [[nodiscard]] bitboard attacks_to(sq_or_bb targets,
+                                    bitboard blockers) const noexcept;
   template <color side>
   [[nodiscard]] bitboard attacks_by_color() const noexcept;
 
-  void do_move(move move) noexcept;
-  void undo_move() noexcept;
+  void do_move(move move, state_info &prev_state) noexcept;
+  void undo_move(move move, const state_info &prev_state) noexcept;
+  // `side` is the side making the move (the side to move when undoing it)
+  template <color side>
+  void do_move(move move, state_info &prev_state) noexcept;
+  template <color side>
+  void undo_move(move move, const state_info &prev_state) noexcept;
+  void do_move(move move, undo_stack &undo) noexcept;
+  void undo_move(undo_stack &undo) noexcept;
 
 private:
+  void clear() noexcept;
+  void load_piece(square sq, piece pc) noexcept;
+  void load_castle(color c, castle_side cs, file rook_file) noexcept;
+  void finish_load() noexcept;
   void move_piece(square from, square to) noexcept;
   void place_piece(square sq, piece pc) noexcept;
   void remove_piece(square sq) noexcept;
+  const check_info &get_check_info() const noexcept;
+#if defined(MPHAM_CHESS_USE_ATTACK_MAPS)
+  void init_attack_maps() noexcept;
+  void update_attack_maps(square sq, piece pc, bool is_placed) noexcept;
+  void add_attacks(color c, bitboard attacks_bb) noexcept;
+  void remove_attacks(color c, bitboard attacks_bb) noexcept;
+#endif
 
   [[nodiscard]] std::string castle_fen_field() const noexcept;
+  [[nodiscard]] char *write_castle_fen_field(char *out) const noexcept;
 };
 
-template <bool use_side_to_move> bool board::is_check() const noexcept {
-  const auto side{use_side_to_move ? _side_to_move : ~_side_to_move};
-  const auto king{utils::make_piece(side, piece_type::king)};
-  const square king_sq{get_piece_bb(king)};
+// positions are cloned with a plain memcpy (e.g. per thread or copy-make)
+static_assert(std::is_trivially_copyable_v<board>);
 
-  const auto enemy_bb{get_color_bb(~side)};
-  const auto checkers{attacks_to(king_sq) & enemy_bb};
-  return !checkers.is_empty();
+template <bool use_side_to_move> bool board::is_check() const noexcept {
+  if constexpr (use_side_to_move) {
+    return !get_checkers_bb().is_empty();
+  } else {
+    // (pseudolegal positions) is the side that just moved in check
+    const auto side{~_side_to_move};
+    const square king_sq{get_piece_bb(side, piece_type::king)};
+    return !(attacks_to(king_sq) & get_color_bb(_side_to_move)).is_empty();
+  }
 }
 
 template <typename sq_or_bb>
   requires(std::same_as<sq_or_bb, square> || std::same_as<sq_or_bb, bitboard>)
 bitboard board::attacks_to(sq_or_bb targets) const noexcept {
-  const auto w_pawns{_piece_bbs[std::to_underlying(piece::w_pawn)]};
-  const auto b_pawns{_piece_bbs[std::to_underlying(piece::b_pawn)]};
-  const auto knights{_piece_bbs[std::to_underlying(piece::w_knight)] |
-                     _piece_bbs[std::to_underlying(piece::b_knight)]};
-  const auto bishops{_piece_bbs[std::to_underlying(piece::w_bishop)] |
-                     _piece_bbs[std::to_underlying(piece::b_bishop)]};
-  const auto rooks{_piece_bbs[std::to_underlying(piece::w_rook)] |
-                   _piece_bbs[std::to_underlying(piece::b_rook)]};
-  const auto queens{_piece_bbs[std::to_underlying(piece::w_queen)] |
-                    _piece_bbs[std::to_underlying(piece::b_queen)]};
-  const auto kings{_piece_bbs[std::to_underlying(piece::w_king)] |
-                   _piece_bbs[std::to_underlying(piece::b_king)]};
-  const auto blockers{get_occupied_bb()};
+  return attacks_to(targets, get_occupied_bb());
+}
+
+template <typename sq_or_bb>
+  requires(std::same_as<sq_or_bb, square> || std::same_as<sq_or_bb, bitboard>)
+bitboard board::attacks_to(sq_or_bb targets, bitboard blockers) const noexcept {
+  const auto piece_type_bb = [this](piece_type pt) {
+    return _piece_type_bbs[std::to_underlying(pt)];
+  };
+  const auto pawns{piece_type_bb(piece_type::pawn)};
+  const auto w_pawns{pawns & _color_bbs[std::to_underlying(color::white)]};
+  const auto b_pawns{pawns & _color_bbs[std::to_underlying(color::black)]};
+  const auto knights{piece_type_bb(piece_type::knight)};
+  const auto bishops{piece_type_bb(piece_type::bishop)};
+  const auto rooks{piece_type_bb(piece_type::rook)};
+  const auto queens{piece_type_bb(piece_type::queen)};
+  const auto kings{piece_type_bb(piece_type::king)};
 
   return (attacks::pawn_attacks<color::white>(targets) & b_pawns) |
          (attacks::pawn_attacks<color::black>(targets) & w_pawns) |
@@ -141,9 +283,9 @@ bitboard board::attacks_to(sq_or_bb targets) const noexcept {
 }
 
 template <color side> bitboard board::attacks_by_color() const noexcept {
-  // TODO : maybe store attack maps and incrementally update
-  //        i.e. benchmark this
-
+#if defined(MPHAM_CHESS_USE_ATTACK_MAPS)
+  return _attacked_bbs[std::to_underlying(side)];
+#else
   bitboard attacks{constants::bb::empty};
 
   const auto pawn{(side == color::white) ? piece::w_pawn : piece::b_pawn};
@@ -168,6 +310,7 @@ template <color side> bitboard board::attacks_by_color() const noexcept {
   attacks |= attacks::king_attacks(get_piece_bb(king));
 
   return attacks;
+#endif
 }
 
 } // namespace mpham_chess
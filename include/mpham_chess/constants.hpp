@@ -17,9 +17,13 @@ inline constexpr int n_castle_sides{2};
 inline constexpr int n_castle_states{16};
 
 inline constexpr int n_fen_fields{6};
+// (at most 71 for the pieces, 4 castle rights and two 10 digit counters)
+inline constexpr std::size_t max_fen_length{128};
 inline constexpr auto start_pos_fen{
     "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"};
 
 inline constexpr std::size_t max_ply{512};
+// (the most legal moves of any known position is 218)
+inline constexpr std::size_t max_moves{256};
 
 } // namespace mpham_chess::constants
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "mpham_chess/attacks.hpp"
+#include "mpham_chess/bitboard.hpp"
+#include "mpham_chess/constants.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/move.hpp"
+#include "mpham_chess/utils.hpp"
+#include "mpham_chess/zobrist.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace mpham_chess::cuckoo {
+
+// Cuckoo hash tables of the reversible moves (a non-pawn piece moving between
+// two squares it attacks on an empty board), keyed by the hash difference the
+// move makes: `get_square_piece_hash(from, pc) ^ get_square_piece_hash(to, pc)
+// ^ get_color_hash()`. A position can repeat an earlier one with a single
+// move iff their hash difference is one of the keys (Kannan's algorithm, see
+// `board::has_upcoming_repetition`).
+//
+// Every key is stored in one of its two slots `h1(key)` and `h2(key)`, so a
+// lookup is at most two probes. Moves are stored as the from/to square bits
+// of `move` (both directions of a move have the same key).
+
+inline constexpr std::size_t table_size{8192};
+inline constexpr std::size_t n_reversible_moves{3668};
+
+struct tables {
+  std::array<zobrist_hash, table_size> _keys{};
+  std::array<std::uint16_t, table_size> _moves{};
+};
+
+[[nodiscard]] constexpr std::size_t h1(zobrist_hash key) noexcept;
+[[nodiscard]] constexpr std::size_t h2(zobrist_hash key) noexcept;
+[[nodiscard]] consteval tables make_tables() noexcept;
+
+constexpr std::size_t h1(zobrist_hash key) noexcept {
+  return key & (table_size - 1);
+}
+
+constexpr std::size_t h2(zobrist_hash key) noexcept {
+  return (key >> 16) & (table_size - 1);
+}
+
+consteval tables make_tables() noexcept {
+  tables tbls{};
+  for (int pc_ind{0}; pc_ind < constants::n_pieces; pc_ind++) {
+    const auto pc{static_cast<piece>(pc_ind)};
+    const auto pt{utils::piecetype_of(pc)};
+    if (pt == piece_type::pawn) {
+      continue;
+    }
+
+    for (int from_ind{0}; from_ind < constants::n_squares; from_ind++) {
+      const square from{from_ind};
+      const bitboard from_bb{from};
+      bitboard attacks_bb{constants::bb::empty};
+      switch (pt) {
+      case piece_type::knight:
+        attacks_bb = attacks::knight_attacks(from_bb);
+        break;
+      case piece_type::bishop:
+        attacks_bb = attacks::slider_attacks<piece_type::bishop>(
+            from_bb, constants::bb::empty);
+        break;
+      case piece_type::rook:
+        attacks_bb = attacks::slider_attacks<piece_type::rook>(
+            from_bb, constants::bb::empty);
+        break;
+      case piece_type::queen:
+        attacks_bb = attacks::slider_attacks<piece_type::queen>(
+            from_bb, constants::bb::empty);
+        break;
+      default:
+        attacks_bb = attacks::king_attacks(from_bb);
+        break;
+      }
+
+      for (int to_ind{from_ind + 1}; to_ind < constants::n_squares; to_ind++) {
+        const square to{to_ind};
+        if ((attacks_bb & bitboard{to}).is_empty()) {
+          continue;
+        }
+
+        auto mv{static_cast<std::uint16_t>(
+            (from_ind << constants::move::from_sq_bit_index) |
+            (to_ind << constants::move::to_sq_bit_index))};
+        auto key{zobrist::get_square_piece_hash(from, pc) ^
+                 zobrist::get_square_piece_hash(to, pc) ^
+                 zobrist::get_color_hash()};
+        // insert, evicting the entry in the slot to its other slot until a
+        // slot is empty (a zero move, i.e. a1a1, is never stored)
+        auto ind{h1(key)};
+        while (true) {
+          std::swap(tbls._keys[ind], key);
+          std::swap(tbls._moves[ind], mv);
+          if (mv == 0) {
+            break;
+          }
+          ind = (ind == h1(key)) ? h2(key) : h1(key);
+        }
+      }
+    }
+  }
+  return tbls;
+}
+
+alignas(64) inline constexpr tables cuckoo_tables{make_tables()};
+
+// every reversible move found a slot
+static_assert(std::ranges::count_if(cuckoo_tables._moves, [](auto mv) {
+                return mv != 0;
+              }) == n_reversible_moves);
+
+} // namespace mpham_chess::cuckoo
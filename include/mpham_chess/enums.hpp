@@ -72,7 +72,7 @@ concept slider_pt = requires() {
 };
 
 // clang-format off
-enum class piece {
+enum class piece : std::uint8_t {
   w_pawn, w_knight, w_bishop, w_rook, w_queen, w_king,
   b_pawn, b_knight, b_bishop, b_rook, b_queen, b_king,
   no_piece
@@ -119,6 +119,31 @@ constexpr castle_rights &operator^=(castle_rights &lhs,
 constexpr castle_rights operator~(castle_rights cr) noexcept;
 [[nodiscard]] constexpr bool operator!(castle_rights cr) noexcept;
 
+// clang-format off
+enum class perft_stat : std::uint8_t {
+  nodes      = 0b00000000, // leaf nodes only (always collected)
+  ply_nodes  = 0b00000001,
+  captures   = 0b00000010,
+  enpassants = 0b00000100,
+  castles    = 0b00001000,
+  promotes   = 0b00010000,
+  checks     = 0b00100000,
+  per_ply    = 0b00111111,
+  divide     = 0b01000000,
+  all        = 0b01111111
+};
+// clang-format on
+
+// How the tree is walked: play and undo each move on one board (restoring
+// from the saved `state_info`), or play it on a copy of the board.
+enum class traversal : std::uint8_t { make_unmake, copy_make };
+
+[[nodiscard]] constexpr perft_stat operator&(perft_stat lhs,
+                                             perft_stat rhs) noexcept;
+[[nodiscard]] constexpr perft_stat operator|(perft_stat lhs,
+                                             perft_stat rhs) noexcept;
+[[nodiscard]] constexpr bool operator!(perft_stat stats) noexcept;
+
 enum class direction {
   N = 8,
   E = 1,
@@ -148,6 +173,9 @@ concept ray_dir = requires() {
 
 enum class flip_type { vert, horiz, diag, antidiag };
 
+// slider attack table indexing: magic multiply-shift or BMI2 `pext`
+enum class slider_lookup { magic, pext };
+
 constexpr color operator~(color c) noexcept {
   return (c == color::white) ? color::black : color::white;
 }
@@ -258,4 +286,19 @@ constexpr bool operator!(castle_rights cr) noexcept {
   return cr == castle_rights::no_castle;
 }
 
+constexpr perft_stat operator&(perft_stat lhs, perft_stat rhs) noexcept {
+  return static_cast<perft_stat>(std::to_underlying(lhs) &
+                                 std::to_underlying(rhs));
+}
+
+constexpr perft_stat operator|(perft_stat lhs, perft_stat rhs) noexcept {
+  const auto tmp{std::to_underlying(lhs) | std::to_underlying(rhs)};
+  assert(tmp <= std::to_underlying(perft_stat::all));
+  return static_cast<perft_stat>(tmp);
+}
+
+constexpr bool operator!(perft_stat stats) noexcept {
+  return stats == perft_stat::nodes;
+}
+
 } // namespace mpham_chess
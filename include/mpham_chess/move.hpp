@@ -103,6 +103,8 @@ public:
   [[nodiscard]] bool is_enpassant() const noexcept;
   [[nodiscard]] bool is_double_pawn_push() const noexcept;
 
+  [[nodiscard]] friend bool operator==(move lhs,
+                                       move rhs) noexcept = default;
   friend std::ostream &operator<<(std::ostream &os, const move &mv) noexcept;
 
 private:
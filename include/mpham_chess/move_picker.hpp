@@ -0,0 +1,66 @@
+#pragma once
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/move.hpp"
+#include "mpham_chess/movelist.hpp"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+
+namespace mpham_chess {
+
+inline constexpr std::size_t n_killers{2};
+
+using killer_moves = std::array<move, n_killers>;
+
+enum class pick_stage {
+  hash_move,
+  gen_captures,
+  captures,
+  killers,
+  gen_quiets,
+  quiets,
+  gen_evasions,
+  evasions,
+  done
+};
+
+// Pseudolegal moves of a position in stages, each generated only once the
+// previous one is exhausted (e.g. a cutoff on the hash move generates
+// nothing):
+//   1. the hash move, if it is pseudolegal here
+//   2. captures and promotions, most valuable victim / least valuable
+//      attacker first
+//   3. the killer moves that are pseudolegal quiet moves here
+//   4. the remaining quiet moves
+// In check the stages after the hash move are replaced by the (legal) evasions,
+// captures and promotions first (as above), then the killers and the other
+// quiet evasions.
+// Moves are not repeated across stages, a `move{}` hash or killer move is
+// ignored. Legality is left to the caller (as with pseudolegal generation).
+class move_picker {
+private:
+  const board &_pos;
+  move _hash_move{};
+  killer_moves _killers{};
+  pick_stage _stage{pick_stage::hash_move};
+  scored_move_list _moves{};
+  std::size_t _n_killers_picked{0};
+  std::size_t _n_quiets_picked{0};
+
+public:
+  [[nodiscard]] explicit move_picker(const board &pos, move hash_move = move{},
+                                     const killer_moves &killers = {}) noexcept;
+
+  [[nodiscard]] std::optional<move> next_move() noexcept;
+  [[nodiscard]] pick_stage get_stage() const noexcept;
+
+private:
+  [[nodiscard]] bool is_hash_or_killer(move mv) const noexcept;
+};
+
+// capture ordering score, also used for (non-capture) promotions
+[[nodiscard]] move_score mvv_lva_score(const board &pos, move mv) noexcept;
+
+} // namespace mpham_chess
@@ -11,9 +11,32 @@
 
 namespace mpham_chess {
 
-// TODO : legal move gen
+// `evasions`: the legal moves of a position in check (the side to move must be
+// in check), i.e. king steps off attacked squares and, in single check only,
+// captures of the checker and interpositions
+enum class move_gen_type { quiet, capture, pseudolegal, legal, evasions };
+
+template <move_gen_type mgt>
+inline constexpr bool is_legal_move_gen_v{(mgt == move_gen_type::legal) ||
+                                          (mgt == move_gen_type::evasions)};
+
+struct move_gen_masks {
+  // Restrictions on the moves of the side to move, computed once per position
+  // for legal and evasion move generation (no restrictions otherwise):
+  //   * `_targets`: squares non-king moves must end on, i.e. everything when
+  //     not in check, the checker or a blocking square when in single check and
+  //     nothing when in double check
+  //   * `_pinned`: pieces pinned to their king, these may only move along the
+  //     line through the king
+  bitboard _targets{constants::bb::universe};
+  bitboard _pinned{constants::bb::empty};
+  square _king_sq{square::no_square};
+
+  [[nodiscard]] bool is_pin_safe(square from, square to) const noexcept;
+};
 
-enum class move_gen_type { quiet, capture, pseudolegal };
+template <move_gen_type mgt, color side>
+[[nodiscard]] move_gen_masks make_move_gen_masks(const board &pos) noexcept;
 
 template <move_gen_type mgt, bool use_side_to_move = true>
 std::size_t generate_moves(const board &pos, move_list &mvlist) noexcept;
@@ -26,15 +49,44 @@ template <move_gen_type mgt, color side, piece_type pt>
 std::size_t generate_moves(const board &pos, move_list &mvlist) noexcept;
 
 template <move_gen_type mgt, color side>
-std::size_t generate_pawn_moves(const board &pos, move_list &mvlist) noexcept;
+std::size_t generate_pawn_moves(const board &pos, move_list &mvlist,
+                                const move_gen_masks &masks) noexcept;
 
 template <move_gen_type mgt, color side>
-std::size_t generate_king_moves(const board &pos, move_list &mvlist) noexcept;
+std::size_t generate_king_moves(const board &pos, move_list &mvlist,
+                                const move_gen_masks &masks) noexcept;
 
 template <move_gen_type mgt, color side, piece_type pt>
   requires((pt != piece_type::pawn) && (pt != piece_type::no_piece_type))
-std::size_t generate_normal_piece_moves(const board &pos,
-                                        move_list &mvlist) noexcept;
+std::size_t generate_normal_piece_moves(const board &pos, move_list &mvlist,
+                                        const move_gen_masks &masks) noexcept;
+
+inline bool move_gen_masks::is_pin_safe(square from, square to) const noexcept {
+  return !(_pinned & bitboard{from}) ||
+         !!(attacks::line_through(_king_sq, from) & bitboard{to});
+}
+
+template <move_gen_type mgt, color side>
+move_gen_masks make_move_gen_masks(const board &pos) noexcept {
+  if constexpr (!is_legal_move_gen_v<mgt>) {
+    return move_gen_masks{};
+  } else {
+    assert(side == pos.get_side_to_move());
+
+    const square king_sq{pos.get_piece_bb(side, piece_type::king)};
+    const auto checkers{pos.get_checkers_bb()};
+    assert((mgt != move_gen_type::evasions) || checkers);
+
+    auto targets{constants::bb::universe};
+    if (checkers.bit_count() > 1) {
+      targets = constants::bb::empty;
+    } else if (checkers) {
+      targets = checkers | attacks::inbetween_squares(king_sq, square{checkers});
+    }
+
+    return move_gen_masks{targets, pos.get_pinned_bb(side), king_sq};
+  }
+}
 
 template <move_gen_type mgt, bool use_side_to_move>
 std::size_t generate_moves(const board &pos, move_list &mvlist) noexcept {
@@ -48,33 +100,45 @@ std::size_t generate_moves(const board &pos, move_list &mvlist) noexcept {
 template <move_gen_type mgt, color side>
 std::size_t generate_moves(const board &pos, move_list &mvlist) noexcept {
   const auto initial_size{mvlist.size()};
-  generate_pawn_moves<mgt, side>(pos, mvlist);
-  generate_king_moves<mgt, side>(pos, mvlist);
-  generate_normal_piece_moves<mgt, side, piece_type::knight>(pos, mvlist);
-  generate_normal_piece_moves<mgt, side, piece_type::bishop>(pos, mvlist);
-  generate_normal_piece_moves<mgt, side, piece_type::rook>(pos, mvlist);
-  generate_normal_piece_moves<mgt, side, piece_type::queen>(pos, mvlist);
+  const auto masks{make_move_gen_masks<mgt, side>(pos)};
+
+  generate_king_moves<mgt, side>(pos, mvlist, masks);
+  if (masks._targets.is_empty()) {
+    // double check: only king moves
+    return mvlist.size() - initial_size;
+  }
+
+  generate_pawn_moves<mgt, side>(pos, mvlist, masks);
+  generate_normal_piece_moves<mgt, side, piece_type::knight>(pos, mvlist,
+                                                             masks);
+  generate_normal_piece_moves<mgt, side, piece_type::bishop>(pos, mvlist,
+                                                             masks);
+  generate_normal_piece_moves<mgt, side, piece_type::rook>(pos, mvlist, masks);
+  generate_normal_piece_moves<mgt, side, piece_type::queen>(pos, mvlist,
+                                                            masks);
   return mvlist.size() - initial_size;
 }
 
 template <move_gen_type mgt, color side, piece_type pt>
   requires(pt != piece_type::no_piece_type)
 std::size_t generate_moves(const board &pos, move_list &mvlist) noexcept {
+  const auto masks{make_move_gen_masks<mgt, side>(pos)};
   if constexpr (pt == piece_type::pawn) {
-    return generate_pawn_moves<mgt, side>(pos, mvlist);
+    return generate_pawn_moves<mgt, side>(pos, mvlist, masks);
   } else if constexpr (pt == piece_type::king) {
-    return generate_king_moves<mgt, side>(pos, mvlist);
+    return generate_king_moves<mgt, side>(pos, mvlist, masks);
   } else {
-    return generate_normal_piece_moves<mgt, side, pt>(pos, mvlist);
+    return generate_normal_piece_moves<mgt, side, pt>(pos, mvlist, masks);
   }
 }
 
 template <move_gen_type mgt, color side>
-std::size_t generate_pawn_moves(const board &pos, move_list &mvlist) noexcept {
+std::size_t generate_pawn_moves(const board &pos, move_list &mvlist,
+                                const move_gen_masks &masks) noexcept {
   const auto initial_size{mvlist.size()};
+  constexpr bool is_legal{is_legal_move_gen_v<mgt>};
 
-  const auto pawn{utils::make_piece(side, piece_type::pawn)};
-  const auto pawns_bb{pos.get_piece_bb(pawn)};
+  const auto pawns_bb{pos.get_piece_bb(side, piece_type::pawn)};
 
   const auto forward{(side == color::white) ? direction::N : direction::S};
   const auto forward_east{(side == color::white) ? direction::NE
@@ -91,20 +155,29 @@ std::size_t generate_pawn_moves(const board &pos, move_list &mvlist) noexcept {
 
   const auto empty_bb{pos.get_unoccupied_bb()};
   const auto enemy_bb{pos.get_color_bb(~side)};
+  const auto targets_bb{masks._targets};
 
   // single and double pushes
   if constexpr ((mgt == move_gen_type::quiet) ||
-                (mgt == move_gen_type::pseudolegal)) {
-    auto pushes_bb{shift<forward>(no_rank7_pawns_bb) & empty_bb};
-    auto double_pushes_bb{shift<forward>(pushes_bb & rank3_bb) & empty_bb};
+                (mgt == move_gen_type::pseudolegal) || is_legal) {
+    const auto all_pushes_bb{shift<forward>(no_rank7_pawns_bb) & empty_bb};
+    auto pushes_bb{all_pushes_bb & targets_bb};
+    auto double_pushes_bb{shift<forward>(all_pushes_bb & rank3_bb) & empty_bb &
+                          targets_bb};
     while (pushes_bb) {
       const auto push_sq{pushes_bb.template pop_lsb<square>()};
       const auto pawn_sq{push_sq - std::to_underlying(forward)};
+      if (is_legal && !masks.is_pin_safe(pawn_sq, push_sq)) {
+        continue;
+      }
       mvlist.emplace_back(pawn_sq, push_sq, constants::move::flags::quiet);
     }
     while (double_pushes_bb) {
       const auto double_push_sq{double_pushes_bb.template pop_lsb<square>()};
       const auto pawn_sq{double_push_sq - 2 * std::to_underlying(forward)};
+      if (is_legal && !masks.is_pin_safe(pawn_sq, double_push_sq)) {
+        continue;
+      }
       mvlist.emplace_back(pawn_sq, double_push_sq,
                           constants::move::flags::double_pawn_push);
     }
@@ -112,28 +185,39 @@ std::size_t generate_pawn_moves(const board &pos, move_list &mvlist) noexcept {
 
   // normal captures, enpassant captures, and promote captures
   if constexpr ((mgt == move_gen_type::capture) ||
-                (mgt == move_gen_type::pseudolegal)) {
+                (mgt == move_gen_type::pseudolegal) || is_legal) {
     auto no_promote_caps_east_bb{shift<forward_east>(no_rank7_pawns_bb) &
-                                 enemy_bb};
+                                 enemy_bb & targets_bb};
     auto no_promote_caps_west_bb{shift<forward_west>(no_rank7_pawns_bb) &
-                                 enemy_bb};
+                                 enemy_bb & targets_bb};
     while (no_promote_caps_east_bb) {
       const auto cap_sq{no_promote_caps_east_bb.template pop_lsb<square>()};
       const auto pawn_sq{cap_sq - std::to_underlying(forward_east)};
+      if (is_legal && !masks.is_pin_safe(pawn_sq, cap_sq)) {
+        continue;
+      }
       mvlist.emplace_back(pawn_sq, cap_sq, constants::move::flags::capture);
     }
     while (no_promote_caps_west_bb) {
       const auto cap_sq{no_promote_caps_west_bb.template pop_lsb<square>()};
       const auto pawn_sq{cap_sq - std::to_underlying(forward_west)};
+      if (is_legal && !masks.is_pin_safe(pawn_sq, cap_sq)) {
+        continue;
+      }
       mvlist.emplace_back(pawn_sq, cap_sq, constants::move::flags::capture);
     }
 
-    auto promote_caps_east_bb{shift<forward_east>(rank7_pawns_bb) & enemy_bb};
-    auto promote_caps_west_bb{shift<forward_west>(rank7_pawns_bb) & enemy_bb};
+    auto promote_caps_east_bb{shift<forward_east>(rank7_pawns_bb) & enemy_bb &
+                              targets_bb};
+    auto promote_caps_west_bb{shift<forward_west>(rank7_pawns_bb) & enemy_bb &
+                              targets_bb};
     while (promote_caps_east_bb) {
       const auto promote_cap_sq{
           promote_caps_east_bb.template pop_lsb<square>()};
       const auto pawn_sq{promote_cap_sq - std::to_underlying(forward_east)};
+      if (is_legal && !masks.is_pin_safe(pawn_sq, promote_cap_sq)) {
+        continue;
+      }
       mvlist.emplace_back(pawn_sq, promote_cap_sq,
                           constants::move::flags::promote_queen_capture);
       mvlist.emplace_back(pawn_sq, promote_cap_sq,
@@ -147,6 +231,9 @@ std::size_t generate_pawn_moves(const board &pos, move_list &mvlist) noexcept {
       const auto promote_cap_sq{
           promote_caps_west_bb.template pop_lsb<square>()};
       const auto pawn_sq{promote_cap_sq - std::to_underlying(forward_west)};
+      if (is_legal && !masks.is_pin_safe(pawn_sq, promote_cap_sq)) {
+        continue;
+      }
       mvlist.emplace_back(pawn_sq, promote_cap_sq,
                           constants::move::flags::promote_queen_capture);
       mvlist.emplace_back(pawn_sq, promote_cap_sq,
@@ -157,22 +244,33 @@ std::size_t generate_pawn_moves(const board &pos, move_list &mvlist) noexcept {
                           constants::move::flags::promote_knight_capture);
     }
 
+    // enpassant removes two pieces from the capturing pawn's line (discovered
+    // checks along the rank), so legality is checked on the resulting
+    // occupancy instead of with the masks
     const auto ep_sq{pos.get_ep_sq()};
     if (ep_sq != square::no_square) {
       auto ep_cap_pawns_bb{attacks::pawn_attacks<~side>(ep_sq) & pawns_bb};
       while (ep_cap_pawns_bb) {
         const auto pawn_sq{ep_cap_pawns_bb.template pop_lsb<square>()};
-        mvlist.emplace_back(pawn_sq, ep_sq, constants::move::flags::enpassant);
+        const move ep_mv{pawn_sq, ep_sq, constants::move::flags::enpassant};
+        if (is_legal && !pos.is_legal(ep_mv)) {
+          continue;
+        }
+        mvlist.emplace_back(ep_mv);
       }
     }
   }
 
   // non-capture pomotions
   if constexpr (mgt != move_gen_type::quiet) {
-    auto promote_pushes_bb{shift<forward>(rank7_pawns_bb) & empty_bb};
+    auto promote_pushes_bb{shift<forward>(rank7_pawns_bb) & empty_bb &
+                           targets_bb};
     while (promote_pushes_bb) {
       const auto promote_sq{promote_pushes_bb.template pop_lsb<square>()};
       const auto pawn_sq{promote_sq - std::to_underlying(forward)};
+      if (is_legal && !masks.is_pin_safe(pawn_sq, promote_sq)) {
+        continue;
+      }
       mvlist.emplace_back(pawn_sq, promote_sq,
                           constants::move::flags::promote_queen);
       mvlist.emplace_back(pawn_sq, promote_sq,
@@ -188,31 +286,60 @@ std::size_t generate_pawn_moves(const board &pos, move_list &mvlist) noexcept {
 }
 
 template <move_gen_type mgt, color side>
-std::size_t generate_king_moves(const board &pos, move_list &mvlist) noexcept {
+std::size_t generate_king_moves(const board &pos, move_list &mvlist,
+                                const move_gen_masks &masks) noexcept {
   const auto initial_size{mvlist.size()};
+  constexpr bool is_legal{is_legal_move_gen_v<mgt>};
 
   const auto king{utils::make_piece(side, piece_type::king)};
   const auto enemy_bb{pos.get_color_bb(~side)};
   const auto occupied_bb{pos.get_occupied_bb()};
-  const auto empty_bb{pos.get_unoccupied_bb()};
 
   // steps
-  generate_normal_piece_moves<mgt, side, piece_type::king>(pos, mvlist);
+  if constexpr (is_legal) {
+    // the king is removed from the blockers so that it cannot step back along
+    // the line of a checking slider
+    const auto king_sq{masks._king_sq};
+    const auto blockers_bb{occupied_bb & ~bitboard{king_sq}};
+    auto steps_bb{attacks::king_attacks(king_sq) & ~pos.get_color_bb(side)};
+    while (steps_bb) {
+      const auto to_sq{steps_bb.template pop_lsb<square>()};
+      if (pos.attacks_to(to_sq, blockers_bb) & enemy_bb) {
+        continue;
+      }
+      const auto flags{(enemy_bb & bitboard{to_sq})
+                           ? constants::move::flags::capture
+                           : constants::move::flags::quiet};
+      mvlist.emplace_back(king_sq, to_sq, flags);
+    }
+  } else {
+    generate_normal_piece_moves<mgt, side, piece_type::king>(pos, mvlist,
+                                                             masks);
+  }
 
   // castling
+  // (`can_do_castle` checks the king's path; the legal check only catches the
+  // castle rook shielding the king's destination, Chess960; never out of check)
   if constexpr ((mgt == move_gen_type::quiet) ||
-                (mgt == move_gen_type::pseudolegal)) {
+                (mgt == move_gen_type::pseudolegal) ||
+                (mgt == move_gen_type::legal)) {
     if (pos.can_do_castle(side, castle_side::king)) {
       const auto king_sq{pos.get_king_castle_sq(side)};
       const auto rook_sq{pos.get_rook_castle_sq(side, castle_side::king)};
-      mvlist.emplace_back(king_sq, rook_sq,
-                          constants::move::flags::king_castle);
+      const move castle_mv{king_sq, rook_sq,
+                           constants::move::flags::king_castle};
+      if (!is_legal || pos.is_legal(castle_mv)) {
+        mvlist.emplace_back(castle_mv);
+      }
     }
     if (pos.can_do_castle(side, castle_side::queen)) {
       const auto king_sq{pos.get_king_castle_sq(side)};
       const auto rook_sq{pos.get_rook_castle_sq(side, castle_side::queen)};
-      mvlist.emplace_back(king_sq, rook_sq,
-                          constants::move::flags::queen_castle);
+      const move castle_mv{king_sq, rook_sq,
+                           constants::move::flags::queen_castle};
+      if (!is_legal || pos.is_legal(castle_mv)) {
+        mvlist.emplace_back(castle_mv);
+      }
     }
   }
 
@@ -221,36 +348,43 @@ std::size_t generate_king_moves(const board &pos, move_list &mvlist) noexcept {
 
 template <move_gen_type mgt, color side, piece_type pt>
   requires((pt != piece_type::pawn) && (pt != piece_type::no_piece_type))
-std::size_t generate_normal_piece_moves(const board &pos,
-                                        move_list &mvlist) noexcept {
+std::size_t generate_normal_piece_moves(const board &pos, move_list &mvlist,
+                                        const move_gen_masks &masks) noexcept {
   const auto initial_size{mvlist.size()};
+  constexpr bool is_legal{is_legal_move_gen_v<mgt>};
+  static_assert(!is_legal || pt != piece_type::king,
+                "legal king moves are generated by `generate_king_moves`");
 
-  const auto pc{utils::make_piece(side, pt)};
   const auto enemy_bb{pos.get_color_bb(~side)};
   const auto empty_bb{pos.get_unoccupied_bb()};
   const auto occupied_bb{pos.get_occupied_bb()};
 
-  // non-captures
-  if constexpr ((mgt == move_gen_type::quiet) ||
-                (mgt == move_gen_type::pseudolegal)) {
-    auto pc_bb{pos.get_piece_bb(pc)};
-    while (pc_bb) {
-      const auto pc_sq{pc_bb.template pop_lsb<square>()};
-      auto no_caps_bb{attacks::attacks<pt>(pc_sq, occupied_bb) & empty_bb};
+  auto pc_bb{pos.get_piece_bb(side, pt)};
+  while (pc_bb) {
+    const auto pc_sq{pc_bb.template pop_lsb<square>()};
+
+    auto targets_bb{attacks::attacks<pt>(pc_sq, occupied_bb)};
+    if constexpr (is_legal) {
+      targets_bb &= masks._targets;
+      if (masks._pinned & bitboard{pc_sq}) {
+        targets_bb &= attacks::line_through(masks._king_sq, pc_sq);
+      }
+    }
+
+    // non-captures
+    if constexpr ((mgt == move_gen_type::quiet) ||
+                  (mgt == move_gen_type::pseudolegal) || is_legal) {
+      auto no_caps_bb{targets_bb & empty_bb};
       while (no_caps_bb) {
         const auto to_sq{no_caps_bb.template pop_lsb<square>()};
         mvlist.emplace_back(pc_sq, to_sq, constants::move::flags::quiet);
       }
     }
-  }
 
-  // captures
-  if constexpr ((mgt == move_gen_type::capture) ||
-                (mgt == move_gen_type::pseudolegal)) {
-    auto pc_bb{pos.get_piece_bb(pc)};
-    while (pc_bb) {
-      const auto pc_sq{pc_bb.template pop_lsb<square>()};
-      auto caps_bb{attacks::attacks<pt>(pc_sq, occupied_bb) & enemy_bb};
+    // captures
+    if constexpr ((mgt == move_gen_type::capture) ||
+                  (mgt == move_gen_type::pseudolegal) || is_legal) {
+      auto caps_bb{targets_bb & enemy_bb};
       while (caps_bb) {
         const auto cap_sq{caps_bb.template pop_lsb<square>()};
         mvlist.emplace_back(pc_sq, cap_sq, constants::move::flags::capture);
@@ -1,13 +1,101 @@
 #pragma once
 
 #include "mpham_chess/constants.hpp"
+#include "mpham_chess/move.hpp"
 
 #include "detail/fixed_vector.hpp"
 
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
 namespace mpham_chess {
 
-class move;
+// (uninitialized storage, declaring a move list at every node costs nothing)
+using move_list = detail::fixed_vector<move, constants::max_moves, false>;
+
+using move_score = std::int32_t;
+
+// Moves with an ordering score each (kept in a parallel array, the moves stay
+// a `move_list` the generators write to). `pick_next` selects the best
+// remaining move one step at a time, so the ordering cost scales with the
+// moves actually used (e.g. before a cutoff) instead of sorting the list.
+class scored_move_list {
+private:
+  move_list _moves{};
+  detail::fixed_vector<move_score, constants::max_moves, false> _scores{};
+  std::size_t _n_picked{0};
+
+public:
+  [[nodiscard]] move_list &get_moves() noexcept;
+  [[nodiscard]] const move_list &get_moves() const noexcept;
+  [[nodiscard]] move_score get_score(std::size_t ind) const noexcept;
+  [[nodiscard]] std::size_t size() const noexcept;
+  [[nodiscard]] std::size_t n_remaining() const noexcept;
+
+  // scores the moves added (e.g. generated into `get_moves()`) since the last
+  // call, `scorer` maps a move to its score
+  template <typename scorer_t> void score_moves(scorer_t &&scorer) noexcept;
+  void push_back(move mv, move_score score) noexcept;
+  // the highest scoring move not picked yet (ties in no particular order)
+  [[nodiscard]] std::optional<move> pick_next() noexcept;
+  void clear() noexcept;
+};
+
+inline move_list &scored_move_list::get_moves() noexcept { return _moves; }
+
+inline const move_list &scored_move_list::get_moves() const noexcept {
+  return _moves;
+}
+
+inline move_score scored_move_list::get_score(std::size_t ind) const noexcept {
+  return _scores[ind];
+}
+
+inline std::size_t scored_move_list::size() const noexcept {
+  return _moves.size();
+}
+
+inline std::size_t scored_move_list::n_remaining() const noexcept {
+  return _moves.size() - _n_picked;
+}
+
+template <typename scorer_t>
+void scored_move_list::score_moves(scorer_t &&scorer) noexcept {
+  for (auto ind{_scores.size()}; ind < _moves.size(); ind++) {
+    _scores.push_back(scorer(_moves[ind]));
+  }
+}
+
+inline void scored_move_list::push_back(move mv, move_score score) noexcept {
+  assert(_scores.size() == _moves.size());
+  _moves.push_back(mv);
+  _scores.push_back(score);
+}
+
+inline std::optional<move> scored_move_list::pick_next() noexcept {
+  assert(_scores.size() == _moves.size());
+  if (_n_picked == _moves.size()) {
+    return std::nullopt;
+  }
+
+  auto best_ind{_n_picked};
+  for (auto ind{_n_picked + 1}; ind < _moves.size(); ind++) {
+    if (_scores[ind] > _scores[best_ind]) {
+      best_ind = ind;
+    }
+  }
+  std::swap(_moves[best_ind], _moves[_n_picked]);
+  std::swap(_scores[best_ind], _scores[_n_picked]);
+  return _moves[_n_picked++];
+}
 
-using move_list = detail::fixed_vector<move, constants::max_ply>;
+inline void scored_move_list::clear() noexcept {
+  _moves.clear();
+  _scores.clear();
+  _n_picked = 0;
+}
 
 } // namespace mpham_chess
@@ -1,11 +1,16 @@
 #pragma once
 
 #include "mpham_chess/board.hpp"
+#include "mpham_chess/enums.hpp"
 #include "mpham_chess/move.hpp"
 #include "mpham_chess/movegen.hpp"
 #include "mpham_chess/movelist.hpp"
+#include "mpham_chess/perft_table.hpp"
 
-#include <array>
+#include "detail/thread_pool.hpp"
+
+#include <atomic>
+#include <cassert>
 #include <cstddef>
 #include <ostream>
 #include <utility>
@@ -13,108 +18,529 @@
 
 namespace mpham_chess {
 
-template <std::size_t perft_depth> struct perft_result;
+template <perft_stat stats> struct perft_result;
 
-template <std::size_t perft_depth>
+template <perft_stat stats>
 std::ostream &operator<<(std::ostream &os,
-                         const perft_result<perft_depth> &result) noexcept;
-
-template <std::size_t perft_depth> struct perft_result {
-  const std::size_t _depth{perft_depth};
-  std::array<std::size_t, perft_depth + 1> _nodes{1};
-  std::array<std::size_t, perft_depth + 1> _captures{};
-  std::array<std::size_t, perft_depth + 1> _enpassants{};
-  std::array<std::size_t, perft_depth + 1> _castles{};
-  std::array<std::size_t, perft_depth + 1> _promotes{};
-  std::array<std::size_t, perft_depth + 1> _checks{};
+                         const perft_result<stats> &result) noexcept;
+
+template <perft_stat stats = perft_stat::all,
+          traversal trav = traversal::make_unmake>
+perft_result<stats> perft(board &pos, unsigned int depth) noexcept;
+
+template <perft_stat stats = perft_stat::divide,
+          traversal trav = traversal::make_unmake>
+perft_result<stats> perft(board &pos, unsigned int depth,
+                          perft_table &table) noexcept;
+
+template <perft_stat stats = perft_stat::all>
+perft_result<stats> perft(const board &pos, unsigned int depth,
+                          std::size_t n_threads) noexcept;
+
+template <perft_stat stats = perft_stat::divide>
+perft_result<stats> perft(const board &pos, unsigned int depth,
+                          std::size_t n_threads, perft_table &table) noexcept;
+
+template <bool bulk_count = true, traversal trav = traversal::make_unmake>
+std::size_t perft_nodes(board &pos, unsigned int depth) noexcept;
+
+template <perft_stat stats>
+perft_result<stats> _parallel_perft(const board &pos, unsigned int depth,
+                                    std::size_t n_threads,
+                                    perft_table *table) noexcept;
+
+template <perft_stat stats>
+void _parallel_perft_task(detail::thread_pool &pool, perft_table *table,
+                          unsigned int depth, board &pos,
+                          std::vector<perft_result<stats>> &worker_results,
+                          std::atomic<std::size_t> &root_nodes,
+                          std::size_t worker_id) noexcept;
+
+template <perft_stat stats>
+void _count_perft_move(move mv, std::size_t ply,
+                       perft_result<stats> &result) noexcept;
+
+template <perft_stat stats>
+void _count_perft_check(const board &pos, std::size_t ply,
+                        perft_result<stats> &result) noexcept;
+
+template <traversal trav, color side, typename visit_t>
+auto _visit_child(board &pos, move mv, visit_t &&visit) noexcept;
+
+template <perft_stat stats, bool is_root, traversal trav>
+std::size_t _perft(unsigned int depth, board &pos,
+                   perft_result<stats> &result) noexcept;
+
+template <perft_stat stats, bool is_root, traversal trav, color side>
+std::size_t _perft(unsigned int depth, board &pos,
+                   perft_result<stats> &result) noexcept;
+
+template <bool bulk_count, traversal trav>
+std::size_t _perft_nodes(unsigned int depth, board &pos) noexcept;
+
+template <bool bulk_count, traversal trav, color side>
+std::size_t _perft_nodes(unsigned int depth, board &pos) noexcept;
+
+inline std::size_t _generate_perft_moves(const board &pos,
+                                         move_list &mvlist) noexcept;
+
+template <color side>
+std::size_t _generate_perft_moves(const board &pos, move_list &mvlist) noexcept;
+
+template <color side>
+std::size_t _count_legal_moves(const board &pos) noexcept;
+
+template <traversal trav>
+std::size_t _hashed_perft(unsigned int depth, board &pos,
+                          perft_table &table) noexcept;
+
+template <traversal trav, color side>
+std::size_t _hashed_perft(unsigned int depth, board &pos,
+                          perft_table &table) noexcept;
+
+template <perft_stat stats> struct perft_result {
+  // `_nodes` always holds the root (ply 0) and the leaf node count (ply
+  // `_depth`), the inner plies are only counted with `perft_stat::ply_nodes`.
+  // The other per-ply statistics are left empty unless selected.
+  unsigned int _depth{0};
+  std::vector<std::size_t> _nodes{};
+  std::vector<std::size_t> _captures{};
+  std::vector<std::size_t> _enpassants{};
+  std::vector<std::size_t> _castles{};
+  std::vector<std::size_t> _promotes{};
+  std::vector<std::size_t> _checks{};
   std::vector<std::pair<move, std::size_t>> _divide_nodes{};
 
+  [[nodiscard]] explicit perft_result(unsigned int depth = 0) noexcept;
+
+  void merge(const perft_result<stats> &other) noexcept;
+
   friend std::ostream &
-  operator<< <>(std::ostream &os,
-                const perft_result<perft_depth> &result) noexcept;
+  operator<< <>(std::ostream &os, const perft_result<stats> &result) noexcept;
 };
 
-template <std::size_t perft_depth>
-const perft_result<perft_depth> perft(board &pos) noexcept {
-  perft_result<perft_depth> result{};
-  _perft<perft_depth, true>(perft_depth, pos, result);
+template <perft_stat stats>
+perft_result<stats>::perft_result(unsigned int depth) noexcept
+    : _depth{depth}, _nodes(depth + 1) {
+  _nodes[0] = 1;
+
+  const auto ply_stat_size{[depth](perft_stat stat) -> std::size_t {
+    return !!(stats & stat) ? depth + 1 : 0;
+  }};
+  _captures.resize(ply_stat_size(perft_stat::captures));
+  _enpassants.resize(ply_stat_size(perft_stat::enpassants));
+  _castles.resize(ply_stat_size(perft_stat::castles));
+  _promotes.resize(ply_stat_size(perft_stat::promotes));
+  _checks.resize(ply_stat_size(perft_stat::checks));
+}
+
+template <perft_stat stats>
+void perft_result<stats>::merge(const perft_result<stats> &other) noexcept {
+  // ply 0 (root) is not counted by workers and the leaf nodes are summed from
+  // the divide
+  assert(_depth == other._depth);
+
+  const auto merge_plies{[](auto &plies, const auto &other_plies) {
+    for (std::size_t ply{1}; ply < plies.size(); ply++) {
+      plies[ply] += other_plies[ply];
+    }
+  }};
+  if constexpr (!!(stats & perft_stat::ply_nodes)) {
+    for (std::size_t ply{1}; ply < _depth; ply++) {
+      _nodes[ply] += other._nodes[ply];
+    }
+  }
+  merge_plies(_captures, other._captures);
+  merge_plies(_enpassants, other._enpassants);
+  merge_plies(_castles, other._castles);
+  merge_plies(_promotes, other._promotes);
+  merge_plies(_checks, other._checks);
+}
+
+template <perft_stat stats, traversal trav>
+perft_result<stats> perft(board &pos, unsigned int depth) noexcept {
+  perft_result<stats> result{depth};
+  result._nodes[depth] = _perft<stats, true, trav>(depth, pos, result);
   return result;
 }
 
-template <std::size_t perft_depth, bool is_root>
-std::size_t _perft(unsigned int depth, board &pos,
-                   perft_result<perft_depth> &result) noexcept {
+template <perft_stat stats, traversal trav>
+perft_result<stats> perft(board &pos, unsigned int depth,
+                          perft_table &table) noexcept {
+  // Hashed perft: subtree leaf counts are cached in `table`, so only the leaf
+  // node count and the divide can be collected.
+  static_assert(!(stats & perft_stat::per_ply),
+                "hashed perft only counts leaf nodes (and the divide)");
+
+  perft_result<stats> result{depth};
   if (depth == 0) {
-    return 1;
+    return result;
   }
+  table.set_root(pos);
 
-  std::size_t nodes{0};
   move_list mvlist{};
-  generate_moves<move_gen_type::pseudolegal>(pos, mvlist);
-
-  if constexpr (is_root) {
-    auto n_legal_mvs{0};
-    for (auto root_mv : mvlist) {
-      pos.do_move(root_mv);
-      if (!pos.is_check<false>()) {
-        ++n_legal_mvs;
-      }
-      pos.undo_move();
+  _generate_perft_moves(pos, mvlist);
+  if constexpr (!!(stats & perft_stat::divide)) {
+    result._divide_nodes.reserve(mvlist.size());
+  }
+  for (auto mv : mvlist) {
+    // (root moves only, the subtrees follow the traversal policy)
+    state_info prev_state{};
+    pos.do_move(mv, prev_state);
+    const auto child_nodes{_hashed_perft<trav>(depth - 1, pos, table)};
+    pos.undo_move(mv, prev_state);
+    if constexpr (!!(stats & perft_stat::divide)) {
+      result._divide_nodes.emplace_back(mv, child_nodes);
     }
-    result._divide_nodes.reserve(n_legal_mvs);
+    result._nodes[depth] += child_nodes;
+  }
+
+  return result;
+}
+
+template <perft_stat stats>
+perft_result<stats> perft(const board &pos, unsigned int depth,
+                          std::size_t n_threads) noexcept {
+  return _parallel_perft<stats>(pos, depth, n_threads, nullptr);
+}
+
+template <perft_stat stats>
+perft_result<stats> perft(const board &pos, unsigned int depth,
+                          std::size_t n_threads, perft_table &table) noexcept {
+  static_assert(!(stats & perft_stat::per_ply),
+                "hashed perft only counts leaf nodes (and the divide)");
+  table.set_root(pos);
+  return _parallel_perft<stats>(pos, depth, n_threads, &table);
+}
+
+template <bool bulk_count, traversal trav>
+std::size_t perft_nodes(board &pos, unsigned int depth) noexcept {
+  // Counts-only perft: returns the number of leaf nodes, no statistics.
+  // With `bulk_count` the last ply is not played, the legal moves of each
+  // depth 1 node are counted directly instead.
+  return _perft_nodes<bulk_count, trav>(depth, pos);
+}
+
+template <perft_stat stats>
+perft_result<stats> _parallel_perft(const board &pos, unsigned int depth,
+                                    std::size_t n_threads,
+                                    perft_table *table) noexcept {
+  // Root moves are split into one task per legal move. While running, a task
+  // splits its own subtree into further tasks whenever there are idle workers
+  // (and nothing left to steal), i.e. deeper subtrees are split on demand.
+  // Every worker counts into its own `perft_result` (merged at the end) and
+  // every task works on its own copy of the position (tasks walk their
+  // subtree with make/unmake).
+  perft_result<stats> result{depth};
+  if (depth == 0) {
+    return result;
   }
 
+  detail::thread_pool pool{n_threads};
+  std::vector<perft_result<stats>> worker_results(pool.size(),
+                                                  perft_result<stats>{depth});
+
+  move_list mvlist{};
+  _generate_perft_moves(pos, mvlist);
+
+  const std::vector<move> root_mvs(mvlist.begin(), mvlist.end());
+  std::vector<std::atomic<std::size_t>> divide_nodes(root_mvs.size());
+
+  for (std::size_t root_ind{0}; root_ind < root_mvs.size(); root_ind++) {
+    _count_perft_move(root_mvs[root_ind], 1, result);
+
+    board child_pos{pos};
+    state_info prev_state{};
+    child_pos.do_move(root_mvs[root_ind], prev_state);
+    _count_perft_check(child_pos, 1, result);
+
+    pool.submit([&, child_pos, root_ind](std::size_t worker_id) mutable {
+      _parallel_perft_task<stats>(pool, table, depth - 1, child_pos,
+                                  worker_results, divide_nodes[root_ind],
+                                  worker_id);
+    });
+  }
+  pool.wait();
+
+  for (const auto &worker_result : worker_results) {
+    result.merge(worker_result);
+  }
+  if constexpr (!!(stats & perft_stat::divide)) {
+    result._divide_nodes.reserve(root_mvs.size());
+  }
+  for (std::size_t root_ind{0}; root_ind < root_mvs.size(); root_ind++) {
+    const auto nodes{divide_nodes[root_ind].load()};
+    if constexpr (!!(stats & perft_stat::divide)) {
+      result._divide_nodes.emplace_back(root_mvs[root_ind], nodes);
+    }
+    result._nodes[depth] += nodes;
+  }
+
+  return result;
+}
+
+template <perft_stat stats>
+void _parallel_perft_task(detail::thread_pool &pool, perft_table *table,
+                          unsigned int depth, board &pos,
+                          std::vector<perft_result<stats>> &worker_results,
+                          std::atomic<std::size_t> &root_nodes,
+                          std::size_t worker_id) noexcept {
+  // subtrees smaller than this are never split (task overhead)
+  constexpr unsigned int min_split_depth{3};
+
+  auto &result{worker_results[worker_id]};
+  if (depth < min_split_depth || !pool.has_idle_workers()) {
+    constexpr auto trav{traversal::make_unmake};
+    const auto nodes{(table != nullptr)
+                         ? _hashed_perft<trav>(depth, pos, *table)
+                         : _perft<stats, false, trav>(depth, pos, result)};
+    root_nodes.fetch_add(nodes, std::memory_order_relaxed);
+    return;
+  }
+
+  const auto ply{result._depth - depth + 1};
+  move_list mvlist{};
+  _generate_perft_moves(pos, mvlist);
   for (auto mv : mvlist) {
-    pos.do_move(mv);
+    _count_perft_move(mv, ply, result);
+
+    board child_pos{pos};
+    state_info prev_state{};
+    child_pos.do_move(mv, prev_state);
+    _count_perft_check(child_pos, ply, result);
 
-    if (!pos.is_check<false>()) {
-      const auto ply{result._depth - depth + 1};
+    pool.submit([&pool, table, &worker_results, &root_nodes, child_pos,
+                 depth](std::size_t worker_id) mutable {
+      _parallel_perft_task<stats>(pool, table, depth - 1, child_pos,
+                                  worker_results, root_nodes, worker_id);
+    });
+  }
+}
+
+template <perft_stat stats>
+void _count_perft_move(move mv, std::size_t ply,
+                       perft_result<stats> &result) noexcept {
+  if constexpr (!!(stats & perft_stat::ply_nodes)) {
+    // leaf nodes are returned by the recursion
+    if (ply < result._depth) {
       ++(result._nodes[ply]);
+    }
+  }
+  if constexpr (!!(stats & perft_stat::captures)) {
+    result._captures[ply] += mv.is_capture();
+  }
+  if constexpr (!!(stats & perft_stat::enpassants)) {
+    result._enpassants[ply] += mv.is_enpassant();
+  }
+  if constexpr (!!(stats & perft_stat::castles)) {
+    result._castles[ply] += mv.is_castle();
+  }
+  if constexpr (!!(stats & perft_stat::promotes)) {
+    result._promotes[ply] += mv.is_promote();
+  }
+}
 
-      if (mv.is_capture()) {
-        ++(result._captures[ply]);
-      }
-      if (mv.is_enpassant()) {
-        ++(result._enpassants[ply]);
-      }
-      if (mv.is_castle()) {
-        ++(result._castles[ply]);
-      }
-      if (mv.is_promote()) {
-        ++(result._promotes[ply]);
+template <perft_stat stats>
+void _count_perft_check(const board &pos, std::size_t ply,
+                        perft_result<stats> &result) noexcept {
+  // `pos` is the position after the move was made
+  if constexpr (!!(stats & perft_stat::checks)) {
+    result._checks[ply] += pos.is_check();
+  }
+}
+
+template <traversal trav, color side, typename visit_t>
+auto _visit_child(board &pos, move mv, visit_t &&visit) noexcept {
+  // plays `mv` (of `side`) and returns `visit(child position)`, `pos` is
+  // unchanged after
+  state_info prev_state{};
+  if constexpr (trav == traversal::copy_make) {
+    board child_pos{pos};
+    child_pos.template do_move<side>(mv, prev_state);
+    return visit(child_pos);
+  } else {
+    pos.template do_move<side>(mv, prev_state);
+    const auto res{visit(pos)};
+    pos.template undo_move<side>(mv, prev_state);
+    return res;
+  }
+}
+
+template <perft_stat stats, bool is_root, traversal trav>
+std::size_t _perft(unsigned int depth, board &pos,
+                   perft_result<stats> &result) noexcept {
+  // the recursion alternates the side to move as a template parameter
+  return (pos.get_side_to_move() == color::white)
+             ? _perft<stats, is_root, trav, color::white>(depth, pos, result)
+             : _perft<stats, is_root, trav, color::black>(depth, pos, result);
+}
+
+template <perft_stat stats, bool is_root, traversal trav, color side>
+std::size_t _perft(unsigned int depth, board &pos,
+                   perft_result<stats> &result) noexcept {
+  if constexpr (!(stats & perft_stat::per_ply) && !is_root) {
+    // nothing left to count below the root
+    return _perft_nodes<true, trav, side>(depth, pos);
+  }
+
+  if (depth == 0) {
+    return 1;
+  }
+
+  const auto ply{result._depth - depth + 1};
+  move_list mvlist{};
+  _generate_perft_moves<side>(pos, mvlist);
+
+  if constexpr (is_root && !!(stats & perft_stat::divide)) {
+    result._divide_nodes.reserve(mvlist.size());
+  }
+
+  if (depth == 1) {
+    // bulk count: the leaf statistics only depend on the moves (checks are
+    // tested without playing them)
+    for (auto mv : mvlist) {
+      _count_perft_move(mv, ply, result);
+      if constexpr (!!(stats & perft_stat::checks)) {
+        result._checks[ply] += pos.gives_check(mv);
       }
-      if (pos.is_check()) {
-        ++(result._checks[ply]);
+      if constexpr (is_root && !!(stats & perft_stat::divide)) {
+        result._divide_nodes.emplace_back(mv, 1);
       }
+    }
+    return mvlist.size();
+  }
 
-      auto child_nodes{_perft<perft_depth, false>(depth - 1, pos, result)};
-      if constexpr (is_root) {
-        result._divide_nodes.emplace_back(mv, child_nodes);
-      }
-      nodes += child_nodes;
+  std::size_t nodes{0};
+  for (auto mv : mvlist) {
+    _count_perft_move(mv, ply, result);
+
+    const auto child_nodes{
+        _visit_child<trav, side>(pos, mv, [&](board &child_pos) {
+          _count_perft_check(child_pos, ply, result);
+          return _perft<stats, false, trav, ~side>(depth - 1, child_pos,
+                                                   result);
+        })};
+    if constexpr (is_root && !!(stats & perft_stat::divide)) {
+      result._divide_nodes.emplace_back(mv, child_nodes);
+    }
+    nodes += child_nodes;
+  }
+
+  return nodes;
+}
+
+template <bool bulk_count, traversal trav>
+std::size_t _perft_nodes(unsigned int depth, board &pos) noexcept {
+  return (pos.get_side_to_move() == color::white)
+             ? _perft_nodes<bulk_count, trav, color::white>(depth, pos)
+             : _perft_nodes<bulk_count, trav, color::black>(depth, pos);
+}
+
+template <bool bulk_count, traversal trav, color side>
+std::size_t _perft_nodes(unsigned int depth, board &pos) noexcept {
+  if (depth == 0) {
+    return 1;
+  }
+  if constexpr (bulk_count) {
+    if (depth == 1) {
+      return _count_legal_moves<side>(pos);
     }
+  }
 
-    pos.undo_move();
+  std::size_t nodes{0};
+  move_list mvlist{};
+  _generate_perft_moves<side>(pos, mvlist);
+  for (auto mv : mvlist) {
+    nodes += _visit_child<trav, side>(pos, mv, [depth](board &child_pos) {
+      return _perft_nodes<bulk_count, trav, ~side>(depth - 1, child_pos);
+    });
   }
 
   return nodes;
 }
 
-template <std::size_t perft_depth>
+inline std::size_t _generate_perft_moves(const board &pos,
+                                         move_list &mvlist) noexcept {
+  return (pos.get_side_to_move() == color::white)
+             ? _generate_perft_moves<color::white>(pos, mvlist)
+             : _generate_perft_moves<color::black>(pos, mvlist);
+}
+
+template <color side>
+std::size_t _generate_perft_moves(const board &pos, move_list &mvlist) noexcept {
+  // the legal moves, in check only the evasions are generated
+  return pos.get_checkers_bb()
+             ? generate_moves<move_gen_type::evasions, side>(pos, mvlist)
+             : generate_moves<move_gen_type::legal, side>(pos, mvlist);
+}
+
+template <color side>
+std::size_t _count_legal_moves(const board &pos) noexcept {
+  move_list mvlist{};
+  return _generate_perft_moves<side>(pos, mvlist);
+}
+
+template <traversal trav>
+std::size_t _hashed_perft(unsigned int depth, board &pos,
+                          perft_table &table) noexcept {
+  return (pos.get_side_to_move() == color::white)
+             ? _hashed_perft<trav, color::white>(depth, pos, table)
+             : _hashed_perft<trav, color::black>(depth, pos, table);
+}
+
+template <traversal trav, color side>
+std::size_t _hashed_perft(unsigned int depth, board &pos,
+                          perft_table &table) noexcept {
+  if (depth == 0) {
+    return 1;
+  }
+  if (depth == 1) {
+    // bulk count, cheaper than a table probe
+    return _count_legal_moves<side>(pos);
+  }
+
+  if (const auto tt_nodes{table.probe(pos.get_hash(), depth)}) {
+    return *tt_nodes;
+  }
+
+  std::size_t nodes{0};
+  move_list mvlist{};
+  _generate_perft_moves<side>(pos, mvlist);
+  for (auto mv : mvlist) {
+    nodes +=
+        _visit_child<trav, side>(pos, mv, [depth, &table](board &child_pos) {
+          return _hashed_perft<trav, ~side>(depth - 1, child_pos, table);
+        });
+  }
+
+  table.store(pos.get_hash(), depth, nodes);
+  return nodes;
+}
+
+template <perft_stat stats>
 std::ostream &operator<<(std::ostream &os,
-                         const perft_result<perft_depth> &result) noexcept {
-  for (auto d{0}; d <= perft_depth; d++) {
-    os << "depth (" << d << "): " << result._nodes[d] << '\n';
-    os << "  captures: " << result._captures[d] << '\n';
-    os << "  enpassants: " << result._enpassants[d] << '\n';
-    os << "  castles: " << result._castles[d] << '\n';
-    os << "  promotes: " << result._promotes[d] << '\n';
-    os << "  checks: " << result._checks[d] << '\n';
-  }
-
-  os << "  divide:\n";
-  for (auto [root_mv, nodes] : result._divide_nodes) {
-    os << "    " << root_mv << ": " << nodes << '\n';
+                         const perft_result<stats> &result) noexcept {
+  const auto print_ply_stat{
+      [&os](const char *name, const auto &plies, std::size_t ply) {
+        if (ply < plies.size()) {
+          os << "  " << name << ": " << plies[ply] << '\n';
+        }
+      }};
+
+  for (std::size_t ply{0}; ply <= result._depth; ply++) {
+    os << "depth (" << ply << "): " << result._nodes[ply] << '\n';
+    print_ply_stat("captures", result._captures, ply);
+    print_ply_stat("enpassants", result._enpassants, ply);
+    print_ply_stat("castles", result._castles, ply);
+    print_ply_stat("promotes", result._promotes, ply);
+    print_ply_stat("checks", result._checks, ply);
+  }
+
+  if constexpr (!!(stats & perft_stat::divide)) {
+    os << "  divide:\n";
+    for (auto [root_mv, nodes] : result._divide_nodes) {
+      os << "    " << root_mv << ": " << nodes << '\n';
+    }
   }
 
   return os;
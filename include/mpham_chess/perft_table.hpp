@@ -0,0 +1,163 @@
+#pragma once
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/zobrist.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace mpham_chess {
+
+class perft_table {
+  // Transposition table for perft:
+  // (zobrist hash, remaining depth) => number of leaf nodes in the subtree
+  //
+  // The table has a fixed power-of-two number of buckets and is indexed by
+  // the (depth mixed) hash. Entries are written without locks using the
+  // "lockless hashing" trick (Hyatt & Mann): each entry stores
+  // `key ^ data` and `data`, so an entry torn by concurrent writers no longer
+  // validates and is simply treated as a miss. This lets parallel perft
+  // threads share a single table.
+  //
+  // Entries are grouped in buckets of two: a depth-preferred entry, which is
+  // only replaced by entries of (at least) the same remaining depth, and an
+  // always-replace entry for everything else.
+  //
+  // Note: the table is only valid for positions sharing the same castle
+  // squares (the hash does not include them). The hashed perft roots call
+  // `set_root`, which clears the table when the (Chess960) castle squares of
+  // the root differ from the previous root's.
+
+private:
+  struct entry {
+    std::atomic<std::uint64_t> _key_xor_data{0};
+    std::atomic<std::uint64_t> _data{0};
+  };
+
+  struct bucket {
+    entry _depth_preferred{};
+    entry _always_replace{};
+  };
+
+  // data (64 bits total)
+  // bits 0-7:  remaining depth
+  // bits 8-63: leaf node count
+  static constexpr int depth_bits{8};
+  static constexpr std::uint64_t depth_mask{(1 << depth_bits) - 1};
+
+  std::unique_ptr<bucket[]> _buckets{};
+  std::size_t _n_buckets{0};
+  // castle squares of the root the entries were computed for
+  std::optional<std::uint64_t> _root_castle_sqs{};
+
+public:
+  static constexpr std::size_t default_size_mb{64};
+
+  [[nodiscard]] explicit perft_table(
+      std::size_t size_mb = default_size_mb) noexcept;
+
+  perft_table(const perft_table &table) = delete;
+  perft_table &operator=(const perft_table &table) = delete;
+
+  [[nodiscard]] std::optional<std::size_t>
+  probe(zobrist_hash hash, unsigned int depth) const noexcept;
+  void store(zobrist_hash hash, unsigned int depth,
+             std::size_t nodes) noexcept;
+  void clear() noexcept;
+  void set_root(const board &root) noexcept;
+
+  [[nodiscard]] std::size_t size() const noexcept;
+  [[nodiscard]] std::size_t size_mb() const noexcept;
+
+private:
+  [[nodiscard]] std::size_t index_of(zobrist_hash hash,
+                                     unsigned int depth) const noexcept;
+};
+
+inline perft_table::perft_table(std::size_t size_mb) noexcept
+    : _n_buckets{std::bit_floor(std::max<std::size_t>(
+          1, (size_mb << 20) / sizeof(bucket)))} {
+  _buckets = std::make_unique<bucket[]>(_n_buckets);
+}
+
+inline std::optional<std::size_t>
+perft_table::probe(zobrist_hash hash, unsigned int depth) const noexcept {
+  const auto &tt_bucket{_buckets[index_of(hash, depth)]};
+  for (const auto *tt_entry :
+       {&tt_bucket._depth_preferred, &tt_bucket._always_replace}) {
+    const auto data{tt_entry->_data.load(std::memory_order_relaxed)};
+    const auto key{tt_entry->_key_xor_data.load(std::memory_order_relaxed) ^
+                   data};
+    if (key == hash && (data & depth_mask) == depth) {
+      return std::size_t{data >> depth_bits};
+    }
+  }
+  return std::nullopt;
+}
+
+inline void perft_table::store(zobrist_hash hash, unsigned int depth,
+                               std::size_t nodes) noexcept {
+  assert(depth <= depth_mask);
+  assert(nodes < (std::uint64_t{1} << (64 - depth_bits)));
+
+  auto &tt_bucket{_buckets[index_of(hash, depth)]};
+  const auto preferred_depth{
+      tt_bucket._depth_preferred._data.load(std::memory_order_relaxed) &
+      depth_mask};
+  auto &tt_entry{(depth >= preferred_depth) ? tt_bucket._depth_preferred
+                                            : tt_bucket._always_replace};
+
+  const std::uint64_t data{(std::uint64_t{nodes} << depth_bits) | depth};
+  tt_entry._key_xor_data.store(hash ^ data, std::memory_order_relaxed);
+  tt_entry._data.store(data, std::memory_order_relaxed);
+}
+
+inline void perft_table::clear() noexcept {
+  for (std::size_t ind{0}; ind < _n_buckets; ind++) {
+    for (auto *tt_entry :
+         {&_buckets[ind]._depth_preferred, &_buckets[ind]._always_replace}) {
+      tt_entry->_key_xor_data.store(0, std::memory_order_relaxed);
+      tt_entry->_data.store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+inline void perft_table::set_root(const board &root) noexcept {
+  // (one byte per castle square, the king squares follow from the rights)
+  std::uint64_t castle_sqs{0};
+  for (auto c : {color::white, color::black}) {
+    for (auto cs : {castle_side::king, castle_side::queen}) {
+      castle_sqs = (castle_sqs << 8) |
+                   std::to_underlying(root.get_rook_castle_sq(c, cs));
+    }
+  }
+  if (_root_castle_sqs && *_root_castle_sqs != castle_sqs) {
+    clear();
+  }
+  _root_castle_sqs = castle_sqs;
+}
+
+inline std::size_t perft_table::size() const noexcept {
+  return 2 * _n_buckets;
+}
+
+inline std::size_t perft_table::size_mb() const noexcept {
+  return (_n_buckets * sizeof(bucket)) >> 20;
+}
+
+inline std::size_t perft_table::index_of(zobrist_hash hash,
+                                         unsigned int depth) const noexcept {
+  // different depths of the same position map to different entries
+  const auto depth_salt{depth * 0x9e3779b97f4a7c15ull};
+  return (hash ^ depth_salt) & (_n_buckets - 1);
+}
+
+} // namespace mpham_chess
@@ -152,7 +152,7 @@ constexpr piece make_piece(color c, piece_type pt) noexcept {
   assert(pt != piece_type::no_piece_type);
   const auto c_ind{std::to_underlying(c)};
   const auto pt_ind{std::to_underlying(pt)};
-  return piece{c_ind * constants::n_piece_types + pt_ind};
+  return static_cast<piece>(c_ind * constants::n_piece_types + pt_ind);
 }
 
 constexpr castle_rights make_castle_rights(color c, castle_side cs) noexcept {
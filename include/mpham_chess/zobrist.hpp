@@ -4,8 +4,14 @@
 #include "mpham_chess/rng.hpp"
 #include "mpham_chess/utils.hpp"
 
+#if defined(MPHAM_CHESS_USE_POLYGLOT_ZOBRIST)
+// generated by CMake from `POLYGLOT_RANDOM64_FILE`
+#include "mpham_chess/polyglot_random64.hpp"
+#endif
+
 #include <array>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -16,47 +22,127 @@ template <std::size_t n> using zobrist_hashes = std::array<zobrist_hash, n>;
 
 namespace zobrist {
 
-[[nodiscard]] inline zobrist_hash get_color_hash() noexcept;
-[[nodiscard]] inline zobrist_hash get_castle_hash(castle_rights cr) noexcept;
-[[nodiscard]] inline zobrist_hash get_enpassant_hash(square sq) noexcept;
-[[nodiscard]] inline zobrist_hash get_square_piece_hash(square sq,
-                                                        piece pc) noexcept;
+// With `MPHAM_CHESS_USE_POLYGLOT_ZOBRIST` (CMake `USE_POLYGLOT_ZOBRIST`) the
+// piece, castle, enpassant and color hashes are the Polyglot "Random64" keys,
+// so position hashes match Polyglot opening books.
+#if defined(MPHAM_CHESS_USE_POLYGLOT_ZOBRIST)
+inline constexpr bool use_polyglot_hashes{true};
+#else
+inline constexpr bool use_polyglot_hashes{false};
+#endif
+
+// the color hash is part of the hash of positions with this side to move
+inline constexpr color hashed_side{use_polyglot_hashes ? color::white
+                                                       : color::black};
+
+[[nodiscard]] constexpr zobrist_hash get_color_hash() noexcept;
+[[nodiscard]] constexpr zobrist_hash get_castle_hash(castle_rights cr) noexcept;
+[[nodiscard]] constexpr zobrist_hash get_enpassant_hash(square sq) noexcept;
+[[nodiscard]] constexpr zobrist_hash get_square_piece_hash(square sq,
+                                                           piece pc) noexcept;
+[[nodiscard]] constexpr zobrist_hash get_material_hash(piece pc) noexcept;
 
 namespace hashes {
 
-inline const zobrist_hash color{rng::main_rng.generate()};
-
-inline const zobrist_hashes<constants::n_castle_states> castle{
-    rng::main_rng.generate_n<constants::n_castle_states>()};
-
-inline const zobrist_hashes<constants::n_files> enpassant{
-    rng::main_rng.generate_n<constants::n_files>()};
+// Compile time tables from fixed seeds, i.e. the same hashes in every binary
+// (hashes can be stored, e.g. tables or books on disk).
+template <std::size_t n>
+[[nodiscard]] consteval zobrist_hashes<n>
+generate(std::uint64_t seed) noexcept {
+  rng::xorshift64 rng{seed};
+  return rng.generate_n<n>();
+}
 
-inline const zobrist_hashes<constants::n_squares * constants::n_pieces>
-    square_piece{
-        rng::main_rng.generate_n<constants::n_squares * constants::n_pieces>()};
+#if defined(MPHAM_CHESS_USE_POLYGLOT_ZOBRIST)
+// Polyglot key layout: 768 piece keys (64 per piece kind, black pawn, white
+// pawn, black knight, ...), 4 castle keys, 8 enpassant file keys, turn key
+inline constexpr std::size_t polyglot_castle_offset{768};
+inline constexpr std::size_t polyglot_enpassant_offset{772};
+inline constexpr std::size_t polyglot_turn_offset{780};
+
+inline constexpr zobrist_hash color{
+    polyglot::random64[polyglot_turn_offset]};
+
+inline constexpr auto castle{[] consteval {
+  // one key per castle right (white king/queen side, black king/queen side,
+  // i.e. the `castle_rights` bits), combined rights xor their keys
+  zobrist_hashes<constants::n_castle_states> castle{};
+  for (std::size_t cr{0}; cr < castle.size(); cr++) {
+    for (std::size_t right{0}; right < 4; right++) {
+      if (cr & (std::size_t{1} << right)) {
+        castle[cr] ^= polyglot::random64[polyglot_castle_offset + right];
+      }
+    }
+  }
+  return castle;
+}()};
+
+inline constexpr auto enpassant{[] consteval {
+  zobrist_hashes<constants::n_files> enpassant{};
+  for (std::size_t f{0}; f < enpassant.size(); f++) {
+    enpassant[f] = polyglot::random64[polyglot_enpassant_offset + f];
+  }
+  return enpassant;
+}()};
+
+inline constexpr auto square_piece{[] consteval {
+  zobrist_hashes<constants::n_squares * constants::n_pieces> square_piece{};
+  for (int sq_ind{0}; sq_ind < constants::n_squares; sq_ind++) {
+    for (int pc_ind{0}; pc_ind < constants::n_pieces; pc_ind++) {
+      const auto pc{static_cast<piece>(pc_ind)};
+      const auto kind{2 * std::to_underlying(utils::piecetype_of(pc)) +
+                      (utils::color_of(pc) == color::white)};
+      square_piece[sq_ind * constants::n_pieces + pc_ind] =
+          polyglot::random64[constants::n_squares * kind + sq_ind];
+    }
+  }
+  return square_piece;
+}()};
+#else
+inline constexpr zobrist_hash color{generate<1>(0x3c6ef372fe94f82b)[0]};
+
+inline constexpr zobrist_hashes<constants::n_castle_states> castle{
+    generate<constants::n_castle_states>(0xa54ff53a5f1d36f1)};
+
+inline constexpr zobrist_hashes<constants::n_files> enpassant{
+    generate<constants::n_files>(0x510e527fade682d1)};
+
+inline constexpr zobrist_hashes<constants::n_squares * constants::n_pieces>
+    square_piece{generate<constants::n_squares * constants::n_pieces>(
+        0x9b05688c2b3e6c1f)};
+#endif
+
+inline constexpr zobrist_hashes<constants::n_pieces> material{
+    generate<constants::n_pieces>(0x1f83d9abfb41bd6b)};
 
 } // namespace hashes
 
-inline zobrist_hash get_color_hash() noexcept { return hashes::color; }
+constexpr zobrist_hash get_color_hash() noexcept { return hashes::color; }
 
-inline zobrist_hash get_castle_hash(castle_rights cr) noexcept {
+constexpr zobrist_hash get_castle_hash(castle_rights cr) noexcept {
   return hashes::castle[std::to_underlying(cr)];
 }
 
-inline zobrist_hash get_enpassant_hash(square sq) noexcept {
+constexpr zobrist_hash get_enpassant_hash(square sq) noexcept {
   assert(sq != square::no_square);
   const auto file{utils::file_of(sq)};
   return hashes::enpassant[std::to_underlying(file)];
 }
 
-inline zobrist_hash get_square_piece_hash(square sq, piece pc) noexcept {
+constexpr zobrist_hash get_square_piece_hash(square sq, piece pc) noexcept {
   assert(sq != square::no_square && pc != piece::no_piece);
   const auto sq_ind{std::to_underlying(sq)};
   const auto pc_ind{std::to_underlying(pc)};
   return hashes::square_piece[sq_ind * constants::n_pieces + pc_ind];
 }
 
+constexpr zobrist_hash get_material_hash(piece pc) noexcept {
+  // material hashes are added (not xor-ed) per piece on the board, i.e. the
+  // material hash is the sum of `count(pc) * get_material_hash(pc)`
+  assert(pc != piece::no_piece);
+  return hashes::material[std::to_underlying(pc)];
+}
+
 } // namespace zobrist
 
 } // namespace mpham_chess
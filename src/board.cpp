@@ -3,13 +3,19 @@
 #include "mpham_chess/attacks.hpp"
 #include "mpham_chess/bitboard.hpp"
 #include "mpham_chess/constants.hpp"
+#include "mpham_chess/cuckoo.hpp"
 #include "mpham_chess/enums.hpp"
 #include "mpham_chess/utils.hpp"
 #include "mpham_chess/zobrist.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cctype>
 #include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
 #include <ostream>
 #include <string>
 #include <string_view>
@@ -17,71 +23,90 @@
 
 namespace mpham_chess {
 
+namespace {
+
+[[nodiscard]] bitboard piece_attacks(piece pc, square sq,
+                                     bitboard occupied) noexcept {
+  switch (utils::piecetype_of(pc)) {
+  case piece_type::pawn:
+    return (utils::color_of(pc) == color::white)
+               ? attacks::pawn_attacks<color::white>(sq)
+               : attacks::pawn_attacks<color::black>(sq);
+  case piece_type::knight:
+    return attacks::knight_attacks(sq);
+  case piece_type::bishop:
+    return attacks::slider_attacks<piece_type::bishop>(sq, occupied);
+  case piece_type::rook:
+    return attacks::slider_attacks<piece_type::rook>(sq, occupied);
+  case piece_type::queen:
+    return attacks::slider_attacks<piece_type::queen>(sq, occupied);
+  case piece_type::king:
+    return attacks::king_attacks(sq);
+  default:
+    assert(false);
+    return constants::bb::empty;
+  }
+}
+
+[[nodiscard]] constexpr square castle_king_to_sq(color c,
+                                                castle_side cs) noexcept {
+  return (c == color::white)
+             ? ((cs == castle_side::king) ? square::g1 : square::c1)
+             : ((cs == castle_side::king) ? square::g8 : square::c8);
+}
+
+[[nodiscard]] constexpr square castle_rook_to_sq(color c,
+                                                castle_side cs) noexcept {
+  return (c == color::white)
+             ? ((cs == castle_side::king) ? square::f1 : square::d1)
+             : ((cs == castle_side::king) ? square::f8 : square::d8);
+}
+
+} // namespace
+
 board::board(std::string_view fen, bool use_shredder_fen) noexcept
     : _use_shredder_fen{use_shredder_fen} {
   load_fen(fen);
 }
 
 void board::load_fen(std::string_view fen) noexcept {
-  for (auto &bb : _piece_bbs) {
-    bb = bitboard{0x0000000000000000};
-  }
-  for (auto &bb : _color_bbs) {
-    bb = bitboard{0x0000000000000000};
-  }
-  for (auto &pc : _piece_list) {
-    pc = piece::no_piece;
-  }
-  _hash = 0;
-  _state_hist.clear();
-  _move_hist.clear();
-  _castle_king_sqs = {square::no_square, square::no_square};
-  _castle_rook_sqs = {{{square::no_square, square::no_square},
-                       {square::no_square, square::no_square}}};
-
-  const std::vector<std::string_view> fen_fields{
-      utils::str::split_string<" ">(fen)};
-  assert(fen_fields.size() == constants::n_fen_fields);
-  const auto pos_field{fen_fields[0]};
-  const auto color_field{fen_fields[1]};
-  const auto castle_field{fen_fields[2]};
-  const auto ep_field{fen_fields[3]};
-  const auto rule50_field{fen_fields[4]};
-  const auto movenum_field{fen_fields[5]};
-
-  bitboard fen_sq_bb{square::h8};
-  const std::vector<std::string_view> pos_rank_fields{
-      utils::str::split_string<"/">(pos_field)};
-  assert(pos_rank_fields.size() == constants::n_ranks);
-  for (auto rank_field : pos_rank_fields) {
-    for (auto it{rank_field.rbegin()}; it != rank_field.rend(); it++) {
-      if (std::isdigit(*it)) {
-        const auto n_empty_sqs{*it - '0'};
-        fen_sq_bb >>= n_empty_sqs;
-      } else if (std::isalpha(*it)) {
-        const auto pc{utils::char_to_piece(*it)};
-        const auto c{utils::color_of(pc)};
-
-        _piece_bbs[std::to_underlying(pc)] |= fen_sq_bb;
-        _color_bbs[std::to_underlying(c)] |= fen_sq_bb;
-        _piece_list[std::to_underlying(square{fen_sq_bb})] = pc;
-        if (pc != piece::no_piece) {
-          _hash ^= zobrist::get_square_piece_hash(square{fen_sq_bb}, pc);
-        }
-
-        fen_sq_bb >>= 1;
-      } else {
-        assert(false);
-      }
+  clear();
+
+  // The fields are parsed in place (no allocation), e.g. for bulk loading
+  // positions from datasets
+  auto next_field = [&fen]() -> std::string_view {
+    fen.remove_prefix(std::min(fen.find_first_not_of(' '), fen.size()));
+    const auto field{fen.substr(0, fen.find(' '))};
+    fen.remove_prefix(field.size());
+    return field;
+  };
+  const auto pos_field{next_field()};
+  const auto color_field{next_field()};
+  const auto castle_field{next_field()};
+  const auto ep_field{next_field()};
+  const auto rule50_field{next_field()};
+  const auto movenum_field{next_field()};
+  assert(!movenum_field.empty());
+
+  // ranks from the 8th, files from the a-file
+  auto rank_ind{constants::n_ranks - 1};
+  auto file_ind{0};
+  for (auto fen_char : pos_field) {
+    if (fen_char == '/') {
+      assert(file_ind == constants::n_files && rank_ind > 0);
+      rank_ind--;
+      file_ind = 0;
+    } else if (('1' <= fen_char) && (fen_char <= '8')) {
+      file_ind += fen_char - '0';
+    } else {
+      load_piece(utils::make_square(file{file_ind}, rank{rank_ind}),
+                 utils::char_to_piece(fen_char));
+      file_ind++;
     }
   }
+  assert(rank_ind == 0 && file_ind == constants::n_files);
 
-  if (color_field == "w") {
-    _side_to_move = color::white;
-  } else {
-    _side_to_move = color::black;
-    _hash ^= zobrist::get_color_hash();
-  }
+  _side_to_move = (color_field == "w") ? color::white : color::black;
 
   auto rook_file_of_castle = [this](color c, castle_side cs) -> file {
     const auto rook{utils::make_piece(c, piece_type::rook)};
@@ -124,79 +149,189 @@ void board::load_fen(std::string_view fen) noexcept {
         castle_rook_side = side_of_castle_rook(castle_color, castle_rook_file);
       }
 
-      const auto castle_rook_sq{utils::make_square(
-          castle_rook_file,
-          (castle_color == color::white) ? rank::rank_1 : rank::rank_8)};
-      _castle_rook_sqs[std::to_underlying(castle_color)]
-                      [std::to_underlying(castle_rook_side)] = castle_rook_sq;
-
-      const auto king{(castle_color == color::white) ? piece::w_king
-                                                     : piece::b_king};
-      _castle_king_sqs[std::to_underlying(castle_color)] =
-          square{get_piece_bb(king)};
-
-      _castle |= utils::make_castle_rights(castle_color, castle_rook_side);
+      load_castle(castle_color, castle_rook_side, castle_rook_file);
     }
   }
-  _hash ^= zobrist::get_castle_hash(_castle);
 
   _ep_sq = utils::str_to_sq(ep_field);
-  if (_ep_sq != square::no_square) {
-    _hash ^= zobrist::get_enpassant_hash(_ep_sq);
-  }
 
   std::from_chars(rule50_field.begin(), rule50_field.end(), _rule50);
   std::from_chars(movenum_field.begin(), movenum_field.end(), _start_movenum);
+
+  finish_load();
 }
 
 std::string board::to_fen() const noexcept {
-  std::string fen{""};
+  fen_buffer buf{};
+  return std::string{write_fen(buf)};
+}
+
+std::string_view board::write_fen(fen_buffer &buf) const noexcept {
+  auto out{buf.data()};
+  const auto write_number = [&out, &buf](unsigned int num) -> void {
+    out = std::to_chars(out, buf.data() + buf.size(), num).ptr;
+  };
 
-  auto n_empty_sqs{0};
-  auto write_empty_sqs = [&n_empty_sqs, &fen]() -> void {
+  for (auto rank_ind{constants::n_ranks - 1}; rank_ind >= 0; rank_ind--) {
+    auto n_empty_sqs{0};
+    for (auto file_ind{0}; file_ind < constants::n_files; file_ind++) {
+      const auto pc{
+          get_piece_on_sq(utils::make_square(file{file_ind}, rank{rank_ind}))};
+      if (pc == piece::no_piece) {
+        n_empty_sqs++;
+        continue;
+      }
+      if (n_empty_sqs > 0) {
+        *out++ = static_cast<char>('0' + n_empty_sqs);
+        n_empty_sqs = 0;
+      }
+      *out++ = utils::piece_to_char(pc);
+    }
     if (n_empty_sqs > 0) {
-      fen += std::to_string(n_empty_sqs);
-      n_empty_sqs = 0;
+      *out++ = static_cast<char>('0' + n_empty_sqs);
     }
-  };
+    *out++ = (rank_ind > 0) ? '/' : ' ';
+  }
 
-  const auto sqs_fen_order = [] consteval {
-    std::array<square, constants::n_squares> sqs_fen_order{};
-    for (auto sq_ind{0}; sq_ind < constants::n_squares; sq_ind++) {
-      sqs_fen_order[sq_ind] = utils::flip<flip_type::vert>(square{sq_ind});
+  *out++ = (_side_to_move == color::white) ? 'w' : 'b';
+  *out++ = ' ';
+  out = write_castle_fen_field(out);
+  *out++ = ' ';
+  const auto ep_str{utils::sq_to_str(_ep_sq)};
+  out = std::ranges::copy(ep_str, out).out;
+  *out++ = ' ';
+  write_number(_rule50);
+  *out++ = ' ';
+  write_number(get_movenum());
+
+  return std::string_view{buf.data(), out};
+}
+
+packed_board board::pack() const noexcept {
+  packed_board packed{};
+
+  const auto occupied{get_occupied_bb()};
+  // (16 bytes of piece nibbles)
+  assert(occupied.bit_count() <= 32);
+  packed._occupied = static_cast<std::uint64_t>(occupied);
+  auto pieces_bb{occupied};
+  for (std::size_t pc_ind{0}; pieces_bb; pc_ind++) {
+    const auto pc{get_piece_on_sq(pieces_bb.template pop_lsb<square>())};
+    packed._pieces[pc_ind / 2] |= static_cast<std::uint8_t>(
+        std::to_underlying(pc) << (4 * (pc_ind % 2)));
+  }
+
+  for (auto c : {color::white, color::black}) {
+    for (auto cs : {castle_side::king, castle_side::queen}) {
+      if (!(_castle & utils::make_castle_rights(c, cs))) {
+        continue;
+      }
+      const auto rook_file{utils::file_of(get_rook_castle_sq(c, cs))};
+      const auto shift{4 * (constants::n_castle_sides * std::to_underlying(c) +
+                            std::to_underlying(cs))};
+      packed._castle_rook_files &=
+          static_cast<std::uint16_t>(~(packed_board::no_castle_file << shift));
+      packed._castle_rook_files |=
+          static_cast<std::uint16_t>(std::to_underlying(rook_file) << shift);
     }
-    return sqs_fen_order;
-  }();
-  for (auto fen_sq : sqs_fen_order) {
-    const auto pc{get_piece_on_sq(fen_sq)};
+  }
 
-    if (pc == piece::no_piece) {
-      n_empty_sqs++;
-    } else {
-      write_empty_sqs();
-      fen += utils::piece_to_char(pc);
+  packed._side_to_move =
+      static_cast<std::uint8_t>(std::to_underlying(_side_to_move));
+  packed._ep_sq = static_cast<std::uint8_t>(std::to_underlying(_ep_sq));
+  packed._rule50 = static_cast<std::uint16_t>(std::min(_rule50, 0xFFFFu));
+  packed._movenum =
+      static_cast<std::uint16_t>(std::min(get_movenum(), 0xFFFFu));
+
+  return packed;
+}
+
+void board::unpack(const packed_board &packed) noexcept {
+  // Goes straight from the packed occupancy and nibbles to the bitboards,
+  // mailbox and hashes: pieces are collected per piece (one bitboard and one
+  // Zobrist key per piece) and the board state is combined from those once,
+  // instead of updating every bitboard and hash per piece (`load_piece`).
+  std::array<bitboard, constants::n_pieces> pc_bbs{};
+  std::array<zobrist_hash, constants::n_pieces> pc_hashes{};
+  _piece_list.fill(piece::no_piece);
+  // (the material hash is the sum of one key per piece)
+  _material_hash = 0;
+
+  bitboard pieces_bb{packed._occupied};
+  assert(pieces_bb.bit_count() <= 32);
+  for (std::size_t pc_ind{0}; pieces_bb; pc_ind++) {
+    const auto pc_nibble{(packed._pieces[pc_ind / 2] >> (4 * (pc_ind % 2))) &
+                         0xF};
+    assert(pc_nibble < std::to_underlying(piece::no_piece));
+    const auto sq{pieces_bb.template pop_lsb<square>()};
+    const auto pc{static_cast<piece>(pc_nibble)};
+    _piece_list[std::to_underlying(sq)] = pc;
+    pc_bbs[pc_nibble] |= bitboard{sq};
+    pc_hashes[pc_nibble] ^= zobrist::get_square_piece_hash(sq, pc);
+    _material_hash += zobrist::get_material_hash(pc);
+  }
+
+  _pawn_hash = 0;
+  _non_pawn_hashes = {};
+  _color_bbs = {};
+  for (auto c : {color::white, color::black}) {
+    for (auto pt_ind{0}; pt_ind < constants::n_piece_types; pt_ind++) {
+      const auto pc{utils::make_piece(c, piece_type{pt_ind})};
+      const auto pc_ind{std::to_underlying(pc)};
+      if (pt_ind == std::to_underlying(piece_type::pawn)) {
+        _pawn_hash ^= pc_hashes[pc_ind];
+      } else {
+        _non_pawn_hashes[std::to_underlying(c)] ^= pc_hashes[pc_ind];
+      }
+      _color_bbs[std::to_underlying(c)] |= pc_bbs[pc_ind];
     }
+  }
+  for (auto pt_ind{0}; pt_ind < constants::n_piece_types; pt_ind++) {
+    _piece_type_bbs[pt_ind] =
+        pc_bbs[pt_ind] | pc_bbs[constants::n_piece_types + pt_ind];
+  }
+  _hash = _pawn_hash ^ _non_pawn_hashes[std::to_underlying(color::white)] ^
+          _non_pawn_hashes[std::to_underlying(color::black)];
+  _ply = 0;
+  _castle_king_sqs = {square::no_square, square::no_square};
+  _castle_rook_sqs = {{{square::no_square, square::no_square},
+                       {square::no_square, square::no_square}}};
+
+  _side_to_move = color{packed._side_to_move};
 
-    if (utils::file_of(fen_sq) == file::file_h) {
-      write_empty_sqs();
-      if (fen_sq != square::h1) {
-        fen += '/';
+  _castle = castle_rights::no_castle;
+  for (auto c : {color::white, color::black}) {
+    for (auto cs : {castle_side::king, castle_side::queen}) {
+      const auto shift{4 * (constants::n_castle_sides * std::to_underlying(c) +
+                            std::to_underlying(cs))};
+      const auto rook_file{(packed._castle_rook_files >> shift) & 0xF};
+      if (rook_file != packed_board::no_castle_file) {
+        load_castle(c, cs, file{rook_file});
       }
     }
   }
 
-  fen += (_side_to_move == color::white) ? " w " : " b ";
-  fen += castle_fen_field() + ' ';
-  fen += std::string{utils::sq_to_str(_ep_sq)} + ' ';
-  fen += std::to_string(_rule50) + ' ';
-  fen += std::to_string(get_movenum());
+  _ep_sq = square{packed._ep_sq};
+  _rule50 = packed._rule50;
+  _start_movenum = packed._movenum;
 
-  return fen;
+  finish_load();
 }
 
 bitboard board::get_piece_bb(piece pc) const noexcept {
   assert(pc != piece::no_piece);
-  return _piece_bbs[std::to_underlying(pc)];
+  return get_piece_bb(utils::color_of(pc), utils::piecetype_of(pc));
+}
+
+bitboard board::get_piece_bb(color c, piece_type pt) const noexcept {
+  assert(pt != piece_type::no_piece_type);
+  return _piece_type_bbs[std::to_underlying(pt)] &
+         _color_bbs[std::to_underlying(c)];
+}
+
+bitboard board::get_piece_type_bb(piece_type pt) const noexcept {
+  assert(pt != piece_type::no_piece_type);
+  return _piece_type_bbs[std::to_underlying(pt)];
 }
 
 bitboard board::get_color_bb(color c) const noexcept {
@@ -231,10 +366,20 @@ unsigned int board::get_movenum() const noexcept {
   return utils::ply_to_full(total_ply);
 }
 
-unsigned int board::get_ply() const noexcept { return _move_hist.size(); }
+unsigned int board::get_ply() const noexcept { return _ply; }
 
 zobrist_hash board::get_hash() const noexcept { return _hash; }
 
+zobrist_hash board::get_pawn_hash() const noexcept { return _pawn_hash; }
+
+zobrist_hash board::get_material_hash() const noexcept {
+  return _material_hash;
+}
+
+zobrist_hash board::get_non_pawn_hash(color c) const noexcept {
+  return _non_pawn_hashes[std::to_underlying(c)];
+}
+
 square board::get_king_castle_sq(color c) const noexcept {
   return _castle_king_sqs[std::to_underlying(c)];
 }
@@ -243,6 +388,45 @@ square board::get_rook_castle_sq(color c, castle_side cs) const noexcept {
   return _castle_rook_sqs[std::to_underlying(c)][std::to_underlying(cs)];
 }
 
+bitboard board::get_checkers_bb() const noexcept {
+  // enemy pieces giving check to the side to move
+  // (cached separately, leaf positions often only need `is_check`; writes the
+  // cache, not thread safe, see the `mutable` members of `board`)
+  if (!_has_checkers) {
+    _has_checkers = true;
+    // (a king can be missing after a king capture by a pseudolegal move)
+    const auto king_bb{get_piece_bb(_side_to_move, piece_type::king)};
+    _check_info._checkers =
+        king_bb ? attacks_to(square{king_bb}) & get_color_bb(~_side_to_move)
+                : constants::bb::empty;
+  }
+  return _check_info._checkers;
+}
+
+bitboard board::get_pinned_bb(color c) const noexcept {
+  // pieces of color `c` that are the only blocker between their king and an
+  // enemy slider
+  return get_king_blockers_bb(c) & get_color_bb(c);
+}
+
+bitboard board::get_king_blockers_bb(color c) const noexcept {
+  return get_check_info()._king_blockers[std::to_underlying(c)];
+}
+
+bitboard board::get_check_sqs_bb(piece_type pt) const noexcept {
+  assert(pt != piece_type::no_piece_type);
+  return get_check_info()._check_sqs[std::to_underlying(pt)];
+}
+
+unsigned int board::get_n_attackers(color c, square sq) const noexcept {
+  assert(sq != square::no_square);
+#if defined(MPHAM_CHESS_USE_ATTACK_MAPS)
+  return _attacker_counts[std::to_underlying(c)][std::to_underlying(sq)];
+#else
+  return (attacks_to(sq) & get_color_bb(c)).bit_count();
+#endif
+}
+
 bool board::is_sq_empty(square sq) const noexcept {
   assert(sq != square::no_square);
   return _piece_list[std::to_underlying(sq)] == piece::no_piece;
@@ -300,49 +484,319 @@ bool board::can_do_castle(color c, castle_side cs) const noexcept {
   return true;
 }
 
-void board::do_move(move move) noexcept {
+bool board::is_legal(move move) const noexcept {
+  // legality of a pseudolegal move without making it
+  const auto side{_side_to_move};
+  const auto from{move.get_from_square()};
+  const auto to{move.get_to_square()};
+
+  if (move.is_castle()) {
+    // king path safety is checked by `can_do_castle` on generation, but the
+    // castle rook may still be shielding the king's destination (Chess960)
+    const auto cs{move.is_king_castle() ? castle_side::king
+                                        : castle_side::queen};
+    const auto king_to{castle_king_to_sq(side, cs)};
+    const auto rook_to{castle_rook_to_sq(side, cs)};
+    const auto occupied_after{
+        (get_occupied_bb() & ~bitboard{from, to}) | bitboard{king_to, rook_to}};
+    return (attacks_to(king_to, occupied_after) & get_color_bb(~side))
+        .is_empty();
+  }
+
+  if (move.is_enpassant()) {
+    // two pieces leave the capturing pawn's rank (discovered checks), so the
+    // king is tested on the occupancy after the move
+    const auto backward{(side == color::white) ? direction::S : direction::N};
+    const auto cap_sq{to + std::to_underlying(backward)};
+    const auto occupied_after{
+        (get_occupied_bb() & ~bitboard{from, cap_sq}) | bitboard{to}};
+    const auto enemy_after{get_color_bb(~side) & ~bitboard{cap_sq}};
+    const square king_sq{get_piece_bb(side, piece_type::king)};
+    return (attacks_to(king_sq, occupied_after) & enemy_after).is_empty();
+  }
+
+  const square king_sq{get_piece_bb(side, piece_type::king)};
+  if (from == king_sq) {
+    // the king is removed from the blockers so that it cannot step back along
+    // the line of a checking slider
+    return (attacks_to(to, get_occupied_bb() & ~bitboard{from}) &
+            get_color_bb(~side))
+        .is_empty();
+  }
+
+  // any other move must capture or block a single checker and keep a pinned
+  // piece on the line through its king
+  const auto checkers{get_checkers_bb()};
+  if (checkers) {
+    if (checkers.bit_count() > 1) {
+      return false;
+    }
+    const auto targets{checkers |
+                       attacks::inbetween_squares(king_sq, square{checkers})};
+    if (!(targets & bitboard{to})) {
+      return false;
+    }
+  }
+  return !(get_pinned_bb(side) & bitboard{from}) ||
+         !!(attacks::line_through(king_sq, from) & bitboard{to});
+}
+
+bool board::gives_check(move move) const noexcept {
+  // does the (legal) move give check, without making it: a direct check from
+  // the destination square or a discovered check by leaving the line between
+  // an own slider and the enemy king
   const auto side{_side_to_move}, enemy{~side};
+  const auto from{move.get_from_square()};
+  const auto to{move.get_to_square()};
+  const auto enemy_king_bb{get_piece_bb(enemy, piece_type::king)};
+  if (!enemy_king_bb) {
+    return false;
+  }
+  const square enemy_king_sq{enemy_king_bb};
+  const auto occupied{get_occupied_bb()};
+  const auto own_queens{get_piece_bb(side, piece_type::queen)};
+  const auto own_bishops{get_piece_bb(side, piece_type::bishop) | own_queens};
+  const auto own_rooks{get_piece_bb(side, piece_type::rook) | own_queens};
+
+  if (move.is_castle()) {
+    // king and rook both move, all lines to the enemy king are rechecked on
+    // the occupancy after the move
+    const auto cs{move.is_king_castle() ? castle_side::king
+                                        : castle_side::queen};
+    const auto rook_to{castle_rook_to_sq(side, cs)};
+    const auto occupied_after{(occupied & ~bitboard{from, to}) |
+                              bitboard{castle_king_to_sq(side, cs), rook_to}};
+    const auto rooks_after{(own_rooks & ~bitboard{to}) | bitboard{rook_to}};
+    return !!(attacks::slider_attacks<piece_type::rook>(enemy_king_sq,
+                                                        occupied_after) &
+              rooks_after) ||
+           !!(attacks::slider_attacks<piece_type::bishop>(enemy_king_sq,
+                                                          occupied_after) &
+              own_bishops);
+  }
+
+  // direct check (a promoted slider may attack through its from square)
+  if (move.is_promote()) {
+    const auto promote_pc{
+        utils::make_piece(side, move.get_promote_piece_type())};
+    const auto occupied_after{(occupied & ~bitboard{from}) | bitboard{to}};
+    if (piece_attacks(promote_pc, to, occupied_after) & enemy_king_bb) {
+      return true;
+    }
+  } else {
+    const auto pt{utils::piecetype_of(get_piece_on_sq(from))};
+    if (get_check_sqs_bb(pt) & bitboard{to}) {
+      return true;
+    }
+  }
+
+  // discovered check
+  if ((get_king_blockers_bb(enemy) & bitboard{from}) &&
+      !(attacks::line_through(enemy_king_sq, from) & bitboard{to})) {
+    return true;
+  }
+
+  if (move.is_enpassant()) {
+    // the captured pawn may also have been the only blocker
+    const auto backward{(side == color::white) ? direction::S : direction::N};
+    const auto cap_sq{to + std::to_underlying(backward)};
+    const auto occupied_after{(occupied & ~bitboard{from, cap_sq}) |
+                              bitboard{to}};
+    return !!(attacks::slider_attacks<piece_type::rook>(enemy_king_sq,
+                                                        occupied_after) &
+              own_rooks) ||
+           !!(attacks::slider_attacks<piece_type::bishop>(enemy_king_sq,
+                                                          occupied_after) &
+              own_bishops);
+  }
+
+  return false;
+}
+
+bool board::is_pseudo_legal(move move) const noexcept {
+  // could `move` (e.g. from a hash table, possibly of another position) be
+  // generated by `generate_moves<move_gen_type::pseudolegal>` here?
+  const auto side{_side_to_move};
+  const auto from{move.get_from_square()};
+  const auto to{move.get_to_square()};
+  const auto pc{get_piece_on_sq(from)};
+  if ((pc == piece::no_piece) || (utils::color_of(pc) != side)) {
+    return false;
+  }
+  const auto pt{utils::piecetype_of(pc)};
+
+  if (move.is_castle()) {
+    const auto cs{move.is_king_castle() ? castle_side::king
+                                        : castle_side::queen};
+    return (from == get_king_castle_sq(side)) &&
+           (to == get_rook_castle_sq(side, cs)) && can_do_castle(side, cs);
+  }
+
+  const auto forward{(side == color::white) ? direction::N : direction::S};
+  const auto pawn_caps{(side == color::white)
+                           ? attacks::pawn_attacks<color::white>(from)
+                           : attacks::pawn_attacks<color::black>(from)};
+  if (move.is_enpassant()) {
+    return (pt == piece_type::pawn) && (to == _ep_sq) &&
+           !!(pawn_caps & bitboard{to});
+  }
+
+  // the capture flag has to match the destination square
+  const auto to_pc{get_piece_on_sq(to)};
+  if (move.is_capture() ? ((to_pc == piece::no_piece) ||
+                           (utils::color_of(to_pc) == side))
+                        : (to_pc != piece::no_piece)) {
+    return false;
+  }
+
+  if (pt != piece_type::pawn) {
+    return !move.is_promote() && !move.is_double_pawn_push() &&
+           !!(piece_attacks(pc, from, get_occupied_bb()) & bitboard{to});
+  }
+
+  // pawns promote exactly when reaching the last rank
+  const auto last_rank{(side == color::white) ? constants::bb::rank_8
+                                              : constants::bb::rank_1};
+  if (move.is_promote() != !!(last_rank & bitboard{to})) {
+    return false;
+  }
+  if (move.is_capture()) {
+    return !!(pawn_caps & bitboard{to});
+  }
+  const auto push_sq{from + std::to_underlying(forward)};
+  if (move.is_double_pawn_push()) {
+    const auto start_rank{(side == color::white) ? constants::bb::rank_2
+                                                 : constants::bb::rank_7};
+    return !!(start_rank & bitboard{from}) && is_sq_empty(push_sq) &&
+           (to == push_sq + std::to_underlying(forward));
+  }
+  return to == push_sq;
+}
+
+bool board::is_repetition(const undo_stack &undo,
+                          unsigned int ply) const noexcept {
+  // Only positions since the last capture or pawn move (the rule50 window)
+  // with the same side to move can repeat, i.e. every second one from four
+  // plies back. Repeating a position after the root is a draw (it can be
+  // repeated again), one at or before the root has to occur three times.
+  const auto n_plies{std::min<std::size_t>(_rule50, undo.size())};
+  unsigned int n_repeats{0};
+  for (std::size_t dist{4}; dist <= n_plies; dist += 2) {
+    if ((undo[undo.size() - dist]._state._hash == _hash) &&
+        ((dist < ply) || (++n_repeats == 2))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool board::has_upcoming_repetition(const undo_stack &undo,
+                                    unsigned int ply) const noexcept {
+  // Can the side to move repeat a position after the root with one reversible
+  // move (Kannan's algorithm)? The opponent's moves since that position have
+  // to cancel out, then the hash difference is the key of the move in the
+  // cuckoo tables (if the squares between are empty). The move may be
+  // illegal (e.g. pinned piece), this is only meant for pruning.
+  const auto n_plies{std::min<std::size_t>(_rule50, undo.size())};
+  if (n_plies < 3) {
+    return false;
+  }
+
+  const auto hash_at = [&undo](std::size_t dist) {
+    return undo[undo.size() - dist]._state._hash;
+  };
+  const auto &[keys, moves]{cuckoo::cuckoo_tables};
+  auto opp_diff{_hash ^ hash_at(1) ^ zobrist::get_color_hash()};
+  for (std::size_t dist{3}; (dist <= n_plies) && (dist < ply); dist += 2) {
+    opp_diff ^= hash_at(dist - 1) ^ hash_at(dist) ^ zobrist::get_color_hash();
+    if (opp_diff != 0) {
+      continue;
+    }
+
+    const auto move_key{_hash ^ hash_at(dist)};
+    auto ind{cuckoo::h1(move_key)};
+    if (keys[ind] != move_key) {
+      ind = cuckoo::h2(move_key);
+      if (keys[ind] != move_key) {
+        continue;
+      }
+    }
+    const move mv{moves[ind]};
+    const auto between{attacks::inbetween_squares(mv.get_from_square(),
+                                                  mv.get_to_square())};
+    if ((between & get_occupied_bb()).is_empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void board::do_move(move move, state_info &prev_state) noexcept {
+  if (_side_to_move == color::white) {
+    do_move<color::white>(move, prev_state);
+  } else {
+    do_move<color::black>(move, prev_state);
+  }
+}
+
+template <color side>
+void board::do_move(move move, state_info &prev_state) noexcept {
+  // the color dependent pieces, squares and directions are constants
+  constexpr auto enemy{~side};
+  constexpr auto backward{(side == color::white) ? direction::S
+                                                 : direction::N};
+  constexpr auto pawn{utils::make_piece(side, piece_type::pawn)};
+  constexpr auto rook{utils::make_piece(side, piece_type::rook)};
+  constexpr auto king{utils::make_piece(side, piece_type::king)};
+  constexpr auto enemy_pawn{utils::make_piece(enemy, piece_type::pawn)};
+  constexpr auto enemy_rook{utils::make_piece(enemy, piece_type::rook)};
+  constexpr auto side_cr{(side == color::white) ? castle_rights::w_both
+                                                : castle_rights::b_both};
+  constexpr auto enemy_cr{(enemy == color::white) ? castle_rights::w_both
+                                                  : castle_rights::b_both};
+  assert(side == _side_to_move);
+
   const auto from{move.get_from_square()};
   const auto to{move.get_to_square()};
   const auto pc{get_piece_on_sq(from)};
-  const auto cap_pc{move.is_enpassant()
-                        ? utils::make_piece(~side, piece_type::pawn)
-                        : get_piece_on_sq(to)};
+  const auto cap_pc{move.is_enpassant() ? enemy_pawn : get_piece_on_sq(to)};
   assert((pc != piece::no_piece) && (utils::color_of(pc) == side));
 
-  _state_hist.emplace_back(_hash, _rule50, _ep_sq, cap_pc, _castle);
+  prev_state = state_info{._hash = _hash,
+                          ._rule50 = _rule50,
+                          ._ep_sq = _ep_sq,
+                          ._cap_pc = cap_pc,
+                          ._castle = _castle};
+  _ply++;
+  _has_checkers = false;
+  _has_check_info = false;
+
+  // castle rights hash is re-applied after all castle rights updates
+  _hash ^= zobrist::get_castle_hash(_castle);
 
-  _side_to_move = ~_side_to_move;
+  _side_to_move = enemy;
   _hash ^= zobrist::get_color_hash();
-  _rule50 = (move.is_capture() || (utils::piecetype_of(pc) == piece_type::pawn))
-                ? 0
-                : _rule50 + 1;
+  _rule50 = (move.is_capture() || (pc == pawn)) ? 0 : _rule50 + 1;
 
   if (_ep_sq != square::no_square) {
     _hash ^= zobrist::get_enpassant_hash(_ep_sq);
   }
   _ep_sq = square::no_square;
   if (move.is_double_pawn_push()) {
-    assert(pc == utils::make_piece(side, piece_type::pawn));
+    assert(pc == pawn);
 
-    const auto enemy_pawn{utils::make_piece(enemy, piece_type::pawn)};
     const auto neighbor_bb{shift<direction::E>(bitboard{to}) |
                            shift<direction::W>(bitboard{to})};
-    const auto enemy_pawn_bb{get_piece_bb(enemy_pawn)};
-
-    if (neighbor_bb & enemy_pawn_bb) {
-      const auto backward{(side == color::white) ? direction::S : direction::N};
+    if (neighbor_bb & get_piece_bb(enemy_pawn)) {
       _ep_sq = to + std::to_underlying(backward);
       _hash ^= zobrist::get_enpassant_hash(_ep_sq);
     }
   }
 
-  const auto side_cr{(side == color::white) ? castle_rights::w_both
-                                            : castle_rights::b_both};
   const auto can_castle{!!(_castle & side_cr)};
-  if (can_castle && (pc == utils::make_piece(side, piece_type::king))) {
+  if (can_castle && (pc == king)) {
     _castle &= ~side_cr;
-  } else if (can_castle && (pc == utils::make_piece(side, piece_type::rook))) {
+  } else if (can_castle && (pc == rook)) {
     for (auto cs : {castle_side::king, castle_side::queen}) {
       if (_castle_rook_sqs[std::to_underlying(side)][std::to_underlying(cs)] ==
           from) {
@@ -351,10 +805,7 @@ void board::do_move(move move) noexcept {
     }
   }
 
-  _move_hist.emplace_back(move);
-
   if (move.is_capture()) {
-    const auto backward{(side == color::white) ? direction::S : direction::N};
     const auto cap_sq{move.is_enpassant() ? (to + std::to_underlying(backward))
                                           : to};
     assert(get_piece_on_sq(cap_sq) == cap_pc);
@@ -362,12 +813,8 @@ void board::do_move(move move) noexcept {
 
     remove_piece(cap_sq);
 
-    const auto enemy_cr{(enemy == color::white) ? castle_rights::w_both
-                                                : castle_rights::b_both};
     const auto enemy_has_castle_rights{!!(_castle & enemy_cr)};
-    const auto is_cap_pc_rook{cap_pc ==
-                              utils::make_piece(enemy, piece_type::rook)};
-    if (enemy_has_castle_rights && is_cap_pc_rook) {
+    if (enemy_has_castle_rights && (cap_pc == enemy_rook)) {
       for (auto cs : {castle_side::king, castle_side::queen}) {
         if (_castle_rook_sqs[std::to_underlying(enemy)]
                             [std::to_underlying(cs)] == cap_sq) {
@@ -378,81 +825,78 @@ void board::do_move(move move) noexcept {
   }
 
   if (move.is_promote()) {
-    assert(pc == utils::make_piece(side, piece_type::pawn));
+    assert(pc == pawn);
 
     const auto promote_pc{
         utils::make_piece(side, move.get_promote_piece_type())};
     remove_piece(from);
     place_piece(to, promote_pc);
   } else if (move.is_castle()) {
-    assert(pc == utils::make_piece(side, piece_type::king));
-    assert(cap_pc == utils::make_piece(side, piece_type::rook));
+    assert(pc == king);
+    assert(cap_pc == rook);
 
-    const auto is_king_castle{move.is_king_castle()};
-    assert(is_king_castle ==
+    const auto cs{move.is_king_castle() ? castle_side::king
+                                        : castle_side::queen};
+    assert((cs == castle_side::king) ==
            (std::to_underlying(from) < std::to_underlying(to)));
 
     const auto rook_from{to};
-    const auto rook_to{(side == color::white)
-                           ? (is_king_castle ? square::f1 : square::d1)
-                           : (is_king_castle ? square::f8 : square::d8)};
     const auto king_from{from};
-    const auto king_to{(side == color::white)
-                           ? (is_king_castle ? square::g1 : square::c1)
-                           : (is_king_castle ? square::g8 : square::c8)};
-
-    const auto king{(side == color::white) ? piece::w_king : piece::b_king};
-    const auto rook{(side == color::white) ? piece::w_rook : piece::b_rook};
     remove_piece(king_from);
     remove_piece(rook_from);
-    place_piece(king_to, king);
-    place_piece(rook_to, rook);
+    place_piece(castle_king_to_sq(side, cs), king);
+    place_piece(castle_rook_to_sq(side, cs), rook);
   } else {
     move_piece(from, to);
   }
-}
 
-void board::undo_move() noexcept {
-  assert(_move_hist.size() > 0 && _state_hist.size() > 0);
+  _hash ^= zobrist::get_castle_hash(_castle);
+}
 
-  const auto prev_state{_state_hist.back()};
-  _state_hist.pop_back();
+void board::undo_move(move prev_move, const state_info &prev_state) noexcept {
+  // the side that made the move is not to move
+  if (_side_to_move == color::black) {
+    undo_move<color::white>(prev_move, prev_state);
+  } else {
+    undo_move<color::black>(prev_move, prev_state);
+  }
+}
 
-  _side_to_move = ~_side_to_move;
-  _hash = prev_state._hash;
+template <color side>
+void board::undo_move(move prev_move, const state_info &prev_state) noexcept {
+  // `side` made the move, i.e. is the side to move again after undoing it
+  constexpr auto backward{(side == color::white) ? direction::S
+                                                 : direction::N};
+  constexpr auto pawn{utils::make_piece(side, piece_type::pawn)};
+  constexpr auto rook{utils::make_piece(side, piece_type::rook)};
+  constexpr auto king{utils::make_piece(side, piece_type::king)};
+  assert(_ply > 0);
+  assert(side == ~_side_to_move);
+  _ply--;
+  _has_checkers = false;
+  _has_check_info = false;
+
+  _side_to_move = side;
   _rule50 = prev_state._rule50;
   _ep_sq = prev_state._ep_sq;
   _castle = prev_state._castle;
 
-  const auto prev_move{_move_hist.back()};
-  _move_hist.pop_back();
-
-  const auto side{_side_to_move};
   const auto from{prev_move.get_from_square()};
   const auto to{prev_move.get_to_square()};
   const auto cap_pc{prev_state._cap_pc};
 
   if (prev_move.is_promote()) {
     remove_piece(to);
-    place_piece(from, utils::make_piece(side, piece_type::pawn));
+    place_piece(from, pawn);
   } else if (prev_move.is_castle()) {
-    const auto is_king_castle{prev_move.is_king_castle()};
-    const auto cs{is_king_castle ? castle_side::king : castle_side::queen};
+    const auto cs{prev_move.is_king_castle() ? castle_side::king
+                                             : castle_side::queen};
 
     const auto rook_from{
         _castle_rook_sqs[std::to_underlying(side)][std::to_underlying(cs)]};
-    const auto rook_to{
-        is_king_castle ? ((side == color::white) ? square::f1 : square::f8)
-                       : ((side == color::white) ? square::d1 : square::d8)};
     const auto king_from{_castle_king_sqs[std::to_underlying(side)]};
-    const auto king_to{
-        is_king_castle ? ((side == color::white) ? square::g1 : square::g8)
-                       : ((side == color::white) ? square::c1 : square::c8)};
-
-    const auto king{(side == color::white) ? piece::w_king : piece::b_king};
-    const auto rook{(side == color::white) ? piece::w_rook : piece::b_rook};
-    remove_piece(king_to);
-    remove_piece(rook_to);
+    remove_piece(castle_king_to_sq(side, cs));
+    remove_piece(castle_rook_to_sq(side, cs));
     place_piece(king_from, king);
     place_piece(rook_from, rook);
   } else {
@@ -460,11 +904,116 @@ void board::undo_move() noexcept {
   }
 
   if (prev_move.is_capture()) {
-    const auto backward{(side == color::white) ? direction::S : direction::N};
     const auto cap_sq{
         prev_move.is_enpassant() ? (to + std::to_underlying(backward)) : to};
     place_piece(cap_sq, cap_pc);
   }
+
+  // restored last (piece moves above also update the hash)
+  _hash = prev_state._hash;
+}
+
+template void board::do_move<color::white>(move move,
+                                           state_info &prev_state) noexcept;
+template void board::do_move<color::black>(move move,
+                                           state_info &prev_state) noexcept;
+template void
+board::undo_move<color::white>(move move,
+                               const state_info &prev_state) noexcept;
+template void
+board::undo_move<color::black>(move move,
+                               const state_info &prev_state) noexcept;
+
+void board::do_move(move move, undo_stack &undo) noexcept {
+  undo.push_back(undo_info{._move = move});
+  do_move(move, undo.back()._state);
+}
+
+void board::undo_move(undo_stack &undo) noexcept {
+  assert(!undo.empty());
+  const auto &[prev_move, prev_state]{undo.back()};
+  undo_move(prev_move, prev_state);
+  undo.pop_back();
+}
+
+void board::clear() noexcept {
+  for (auto &bb : _piece_type_bbs) {
+    bb = bitboard{0x0000000000000000};
+  }
+  for (auto &bb : _color_bbs) {
+    bb = bitboard{0x0000000000000000};
+  }
+  for (auto &pc : _piece_list) {
+    pc = piece::no_piece;
+  }
+  _hash = 0;
+  _pawn_hash = 0;
+  _material_hash = 0;
+  _non_pawn_hashes = {};
+  _ply = 0;
+  _castle_king_sqs = {square::no_square, square::no_square};
+  _castle_rook_sqs = {{{square::no_square, square::no_square},
+                       {square::no_square, square::no_square}}};
+}
+
+void board::load_piece(square sq, piece pc) noexcept {
+  // (loading a position) like `place_piece`, the attack maps are initialized
+  // once all pieces are placed
+  assert(sq != square::no_square && pc != piece::no_piece);
+  const auto c{utils::color_of(pc)};
+  const auto pt{utils::piecetype_of(pc)};
+
+  const auto pc_hash{zobrist::get_square_piece_hash(sq, pc)};
+  _hash ^= pc_hash;
+  if (pt == piece_type::pawn) {
+    _pawn_hash ^= pc_hash;
+  } else {
+    _non_pawn_hashes[std::to_underlying(c)] ^= pc_hash;
+  }
+  _material_hash += zobrist::get_material_hash(pc);
+
+  _piece_type_bbs[std::to_underlying(pt)] |= bitboard{sq};
+  _color_bbs[std::to_underlying(c)] |= bitboard{sq};
+  _piece_list[std::to_underlying(sq)] = pc;
+}
+
+void board::load_castle(color c, castle_side cs, file rook_file) noexcept {
+  const auto castle_rook_sq{utils::make_square(
+      rook_file, (c == color::white) ? rank::rank_1 : rank::rank_8)};
+  _castle_rook_sqs[std::to_underlying(c)][std::to_underlying(cs)] =
+      castle_rook_sq;
+
+  const auto king{(c == color::white) ? piece::w_king : piece::b_king};
+  _castle_king_sqs[std::to_underlying(c)] = square{get_piece_bb(king)};
+
+  _castle |= utils::make_castle_rights(c, cs);
+}
+
+void board::finish_load() noexcept {
+  // hashes of the non-piece state and the derived state of a loaded position
+  if (_side_to_move == zobrist::hashed_side) {
+    _hash ^= zobrist::get_color_hash();
+  }
+  _hash ^= zobrist::get_castle_hash(_castle);
+  if (_ep_sq != square::no_square) {
+    // as after a double push (`do_move`, Polyglot), the enpassant square is
+    // only kept (and hashed) when a pawn of the side to move can capture
+    const auto ep_attackers_bb{
+        (_side_to_move == color::white)
+            ? attacks::pawn_attacks<color::black>(_ep_sq)
+            : attacks::pawn_attacks<color::white>(_ep_sq)};
+    if (ep_attackers_bb & get_piece_bb(_side_to_move, piece_type::pawn)) {
+      _hash ^= zobrist::get_enpassant_hash(_ep_sq);
+    } else {
+      _ep_sq = square::no_square;
+    }
+  }
+
+#if defined(MPHAM_CHESS_USE_ATTACK_MAPS)
+  init_attack_maps();
+#endif
+  _has_checkers = false;
+  _has_check_info = false;
 }
 
 void board::move_piece(square from, square to) noexcept {
@@ -473,16 +1022,29 @@ void board::move_piece(square from, square to) noexcept {
   [[maybe_unused]] const auto to_pc{get_piece_on_sq(to)};
   assert(pc != piece::no_piece && to_pc == piece::no_piece);
 
+#if defined(MPHAM_CHESS_USE_ATTACK_MAPS)
+  // the attack maps are updated one occupancy change at a time
+  remove_piece(from);
+  place_piece(to, pc);
+#else
   const auto c{utils::color_of(pc)};
+  const auto pt{utils::piecetype_of(pc)};
   const bitboard fromto_bb{from, to};
 
   _color_bbs[std::to_underlying(c)] ^= fromto_bb;
-  _piece_bbs[std::to_underlying(pc)] ^= fromto_bb;
-  _hash ^= zobrist::get_square_piece_hash(from, pc) ^
-           zobrist::get_square_piece_hash(to, pc);
+  _piece_type_bbs[std::to_underlying(pt)] ^= fromto_bb;
+  const auto fromto_hash{zobrist::get_square_piece_hash(from, pc) ^
+                         zobrist::get_square_piece_hash(to, pc)};
+  _hash ^= fromto_hash;
+  if (pt == piece_type::pawn) {
+    _pawn_hash ^= fromto_hash;
+  } else {
+    _non_pawn_hashes[std::to_underlying(c)] ^= fromto_hash;
+  }
 
   _piece_list[std::to_underlying(from)] = piece::no_piece;
   _piece_list[std::to_underlying(to)] = pc;
+#endif
 }
 
 void board::place_piece(square sq, piece pc) noexcept {
@@ -490,13 +1052,25 @@ void board::place_piece(square sq, piece pc) noexcept {
   assert(get_piece_on_sq(sq) == piece::no_piece);
 
   const auto c{utils::color_of(pc)};
+  const auto pt{utils::piecetype_of(pc)};
   const bitboard sq_bb{sq};
+  const auto pc_hash{zobrist::get_square_piece_hash(sq, pc)};
 
   _color_bbs[std::to_underlying(c)] ^= sq_bb;
-  _piece_bbs[std::to_underlying(pc)] ^= sq_bb;
-  _hash ^= zobrist::get_square_piece_hash(sq, pc);
+  _piece_type_bbs[std::to_underlying(pt)] ^= sq_bb;
+  _hash ^= pc_hash;
+  if (pt == piece_type::pawn) {
+    _pawn_hash ^= pc_hash;
+  } else {
+    _non_pawn_hashes[std::to_underlying(c)] ^= pc_hash;
+  }
+  _material_hash += zobrist::get_material_hash(pc);
 
   _piece_list[std::to_underlying(sq)] = pc;
+
+#if defined(MPHAM_CHESS_USE_ATTACK_MAPS)
+  update_attack_maps(sq, pc, true);
+#endif
 }
 
 void board::remove_piece(square sq) noexcept {
@@ -505,18 +1079,184 @@ void board::remove_piece(square sq) noexcept {
   assert(pc != piece::no_piece);
 
   const auto c{utils::color_of(pc)};
+  const auto pt{utils::piecetype_of(pc)};
   const bitboard sq_bb{sq};
+  const auto pc_hash{zobrist::get_square_piece_hash(sq, pc)};
 
   _color_bbs[std::to_underlying(c)] ^= sq_bb;
-  _piece_bbs[std::to_underlying(pc)] ^= sq_bb;
-  _hash ^= zobrist::get_square_piece_hash(sq, pc);
+  _piece_type_bbs[std::to_underlying(pt)] ^= sq_bb;
+  _hash ^= pc_hash;
+  if (pt == piece_type::pawn) {
+    _pawn_hash ^= pc_hash;
+  } else {
+    _non_pawn_hashes[std::to_underlying(c)] ^= pc_hash;
+  }
+  _material_hash -= zobrist::get_material_hash(pc);
 
   _piece_list[std::to_underlying(sq)] = piece::no_piece;
+
+#if defined(MPHAM_CHESS_USE_ATTACK_MAPS)
+  update_attack_maps(sq, pc, false);
+#endif
+}
+
+const check_info &board::get_check_info() const noexcept {
+  // king blockers and check squares (the checkers are computed by
+  // `get_checkers_bb`), computed on first use (not thread safe, see the
+  // `mutable` members of `board`)
+  if (_has_check_info) {
+    return _check_info;
+  }
+  _has_check_info = true;
+
+  const auto side{_side_to_move}, enemy{~side};
+  const auto occupied{get_occupied_bb()};
+  const auto queens{get_piece_type_bb(piece_type::queen)};
+  const auto rooks{get_piece_type_bb(piece_type::rook) | queens};
+  const auto bishops{get_piece_type_bb(piece_type::bishop) | queens};
+
+  const auto king_blockers{[&](color c) {
+    const auto king_bb{get_piece_bb(c, piece_type::king)};
+    if (!king_bb) {
+      return constants::bb::empty;
+    }
+    const square king_sq{king_bb};
+    const auto enemy_bb{get_color_bb(~c)};
+    auto snipers{
+        (attacks::attacks<piece_type::rook>(king_sq) & rooks & enemy_bb) |
+        (attacks::attacks<piece_type::bishop>(king_sq) & bishops & enemy_bb)};
+
+    auto blockers{constants::bb::empty};
+    while (snipers) {
+      const auto sniper_sq{snipers.template pop_lsb<square>()};
+      const auto between{attacks::inbetween_squares(king_sq, sniper_sq) &
+                         occupied};
+      if (between.bit_count() == 1) {
+        blockers |= between;
+      }
+    }
+    return blockers;
+  }};
+  _check_info._king_blockers[std::to_underlying(side)] = king_blockers(side);
+  _check_info._king_blockers[std::to_underlying(enemy)] = king_blockers(enemy);
+
+  auto &check_sqs{_check_info._check_sqs};
+  const auto enemy_king_bb{get_piece_bb(enemy, piece_type::king)};
+  if (!enemy_king_bb) {
+    check_sqs = {};
+    return _check_info;
+  }
+  const square enemy_king_sq{enemy_king_bb};
+  const auto bishop_check_sqs{
+      attacks::slider_attacks<piece_type::bishop>(enemy_king_sq, occupied)};
+  const auto rook_check_sqs{
+      attacks::slider_attacks<piece_type::rook>(enemy_king_sq, occupied)};
+  check_sqs[std::to_underlying(piece_type::pawn)] =
+      (side == color::white)
+          ? attacks::pawn_attacks<color::black>(enemy_king_sq)
+          : attacks::pawn_attacks<color::white>(enemy_king_sq);
+  check_sqs[std::to_underlying(piece_type::knight)] =
+      attacks::knight_attacks(enemy_king_sq);
+  check_sqs[std::to_underlying(piece_type::bishop)] = bishop_check_sqs;
+  check_sqs[std::to_underlying(piece_type::rook)] = rook_check_sqs;
+  check_sqs[std::to_underlying(piece_type::queen)] =
+      bishop_check_sqs | rook_check_sqs;
+  check_sqs[std::to_underlying(piece_type::king)] = constants::bb::empty;
+
+  return _check_info;
+}
+
+#if defined(MPHAM_CHESS_USE_ATTACK_MAPS)
+void board::init_attack_maps() noexcept {
+  _attacked_bbs = {};
+  _attacker_counts = {};
+
+  const auto occupied{get_occupied_bb()};
+  auto pieces_bb{occupied};
+  while (pieces_bb) {
+    const auto sq{pieces_bb.template pop_lsb<square>()};
+    const auto pc{get_piece_on_sq(sq)};
+    add_attacks(utils::color_of(pc), piece_attacks(pc, sq, occupied));
+  }
 }
 
+void board::update_attack_maps(square sq, piece pc, bool is_placed) noexcept {
+  // `pc` was just placed on (removed from) `sq`: add (subtract) its attacks
+  // and subtract (add) the slider attacks behind `sq` it now blocks (unblocks)
+  const auto occupied{get_occupied_bb()};
+  const auto other_occupied{occupied ^ bitboard{sq}};
+  const auto queens{get_piece_type_bb(piece_type::queen)};
+
+  auto bishops{attacks::slider_attacks<piece_type::bishop>(sq, occupied) &
+               (get_piece_type_bb(piece_type::bishop) | queens)};
+  while (bishops) {
+    const auto slider_sq{bishops.template pop_lsb<square>()};
+    const auto c{utils::color_of(get_piece_on_sq(slider_sq))};
+    const auto behind_sq{
+        attacks::slider_attacks<piece_type::bishop>(slider_sq, occupied) ^
+        attacks::slider_attacks<piece_type::bishop>(slider_sq,
+                                                    other_occupied)};
+    if (is_placed) {
+      remove_attacks(c, behind_sq);
+    } else {
+      add_attacks(c, behind_sq);
+    }
+  }
+
+  auto rooks{attacks::slider_attacks<piece_type::rook>(sq, occupied) &
+             (get_piece_type_bb(piece_type::rook) | queens)};
+  while (rooks) {
+    const auto slider_sq{rooks.template pop_lsb<square>()};
+    const auto c{utils::color_of(get_piece_on_sq(slider_sq))};
+    const auto behind_sq{
+        attacks::slider_attacks<piece_type::rook>(slider_sq, occupied) ^
+        attacks::slider_attacks<piece_type::rook>(slider_sq, other_occupied)};
+    if (is_placed) {
+      remove_attacks(c, behind_sq);
+    } else {
+      add_attacks(c, behind_sq);
+    }
+  }
+
+  const auto pc_attacks{piece_attacks(pc, sq, occupied)};
+  if (is_placed) {
+    add_attacks(utils::color_of(pc), pc_attacks);
+  } else {
+    remove_attacks(utils::color_of(pc), pc_attacks);
+  }
+}
+
+void board::add_attacks(color c, bitboard attacks_bb) noexcept {
+  auto &counts{_attacker_counts[std::to_underlying(c)]};
+  _attacked_bbs[std::to_underlying(c)] |= attacks_bb;
+  while (attacks_bb) {
+    const auto sq{attacks_bb.template pop_lsb<square>()};
+    counts[std::to_underlying(sq)]++;
+  }
+}
+
+void board::remove_attacks(color c, bitboard attacks_bb) noexcept {
+  auto &counts{_attacker_counts[std::to_underlying(c)]};
+  auto &attacked_bb{_attacked_bbs[std::to_underlying(c)]};
+  while (attacks_bb) {
+    const auto sq{attacks_bb.template pop_lsb<square>()};
+    assert(counts[std::to_underlying(sq)] > 0);
+    if (--counts[std::to_underlying(sq)] == 0) {
+      attacked_bb &= ~bitboard{sq};
+    }
+  }
+}
+#endif
+
 std::string board::castle_fen_field() const noexcept {
+  std::array<char, constants::n_castle_sides * constants::n_colors> buf{};
+  return std::string{buf.data(), write_castle_fen_field(buf.data())};
+}
+
+char *board::write_castle_fen_field(char *out) const noexcept {
   if (!_castle) {
-    return "-";
+    *out++ = '-';
+    return out;
   }
 
   auto get_castle_char = [this](color c, castle_side cs) -> char {
@@ -551,20 +1291,19 @@ std::string board::castle_fen_field() const noexcept {
                                : std::tolower(castle_char);
   };
 
-  std::string fen{""};
   if (!!(_castle & castle_rights::w_king)) {
-    fen += get_castle_char(color::white, castle_side::king);
+    *out++ = get_castle_char(color::white, castle_side::king);
   }
   if (!!(_castle & castle_rights::w_queen)) {
-    fen += get_castle_char(color::white, castle_side::queen);
+    *out++ = get_castle_char(color::white, castle_side::queen);
   }
   if (!!(_castle & castle_rights::b_king)) {
-    fen += get_castle_char(color::black, castle_side::king);
+    *out++ = get_castle_char(color::black, castle_side::king);
   }
   if (!!(_castle & castle_rights::b_queen)) {
-    fen += get_castle_char(color::black, castle_side::queen);
+    *out++ = get_castle_char(color::black, castle_side::queen);
   }
-  return fen;
+  return out;
 }
 
 std::ostream &operator<<(std::ostream &os, const board &pos) noexcept {
@@ -0,0 +1,57 @@
+// Build-time generator for the magic bitboard slider attack tables.
+//
+// Writes a translation unit defining `attacks::magics::bishop_attack_table`
+// and `attacks::magics::rook_attack_table` (constant-initialized) to the
+// given output file, so that no attack table is built at startup.
+//
+// usage: gen_slider_attack_tables <output.cpp>
+
+#include "mpham_chess/attacks.hpp"
+#include "mpham_chess/enums.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+using namespace mpham_chess;
+
+namespace {
+
+template <piece_type pt>
+void write_attack_table(std::ostream &os, std::string_view name) noexcept {
+  const auto slider_atk_tbl{attacks::magics::make_slider_attack_table<pt>()};
+
+  os << "alignas(64) constinit const slider_attack_table<piece_type::"
+     << ((pt == piece_type::bishop) ? "bishop" : "rook") << "> " << name
+     << "{{\n";
+  for (const auto &attack_bb : slider_atk_tbl) {
+    os << "    bitboard{0x" << std::hex << std::setw(16) << std::setfill('0')
+       << std::uint64_t{attack_bb} << std::dec << "ull},\n";
+  }
+  os << "}};\n\n";
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (argc != 2) {
+    std::cerr << "usage: gen_slider_attack_tables <output.cpp>\n";
+    return 2;
+  }
+
+  std::ofstream out_stream{argv[1]};
+  if (!out_stream) {
+    std::cerr << "failed to open " << argv[1] << '\n';
+    return 1;
+  }
+
+  out_stream << "// Generated by gen_slider_attack_tables -- do not edit.\n\n"
+             << "#include \"mpham_chess/attacks.hpp\"\n\n"
+             << "namespace mpham_chess::attacks::magics {\n\n";
+  write_attack_table<piece_type::bishop>(out_stream, "bishop_attack_table");
+  write_attack_table<piece_type::rook>(out_stream, "rook_attack_table");
+  out_stream << "} // namespace mpham_chess::attacks::magics\n";
+
+  return out_stream ? 0 : 1;
+}
@@ -0,0 +1,151 @@
+#include "mpham_chess/move_picker.hpp"
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/constants.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/move.hpp"
+#include "mpham_chess/movegen.hpp"
+#include "mpham_chess/movelist.hpp"
+#include "mpham_chess/utils.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <optional>
+#include <utility>
+
+namespace mpham_chess {
+
+namespace {
+
+// (indexed by piece type) the king is never captured, as an attacker it is
+// the most valuable piece
+constexpr std::array<move_score, constants::n_piece_types> mvv_lva_values{
+    1, 3, 3, 5, 9, 10};
+// larger than any attacker value, so every victim outranks the next cheaper
+constexpr move_score mvv_lva_victim_scale{16};
+// (evasion captures and promotions rank above every quiet evasion)
+constexpr move_score evasion_capture_score{1 << 16};
+
+} // namespace
+
+move_score mvv_lva_score(const board &pos, move mv) noexcept {
+  assert(mv.is_capture() || mv.is_promote());
+  const auto attacker_pt{
+      utils::piecetype_of(pos.get_piece_on_sq(mv.get_from_square()))};
+  auto score{-mvv_lva_values[std::to_underlying(attacker_pt)]};
+
+  if (mv.is_capture()) {
+    const auto victim_pt{
+        mv.is_enpassant()
+            ? piece_type::pawn
+            : utils::piecetype_of(pos.get_piece_on_sq(mv.get_to_square()))};
+    score +=
+        mvv_lva_victim_scale * mvv_lva_values[std::to_underlying(victim_pt)];
+  }
+  if (mv.is_promote()) {
+    score += mvv_lva_victim_scale *
+             mvv_lva_values[std::to_underlying(mv.get_promote_piece_type())];
+  }
+  return score;
+}
+
+move_picker::move_picker(const board &pos, move hash_move,
+                         const killer_moves &killers) noexcept
+    : _pos{pos}, _hash_move{hash_move}, _killers{killers} {}
+
+std::optional<move> move_picker::next_move() noexcept {
+  switch (_stage) {
+  case pick_stage::hash_move:
+    _stage = _pos.is_check() ? pick_stage::gen_evasions
+                             : pick_stage::gen_captures;
+    if ((_hash_move != move{}) && _pos.is_pseudo_legal(_hash_move)) {
+      return _hash_move;
+    }
+    return next_move();
+
+  case pick_stage::gen_captures:
+    generate_moves<move_gen_type::capture>(_pos, _moves.get_moves());
+    _moves.score_moves([this](move mv) { return mvv_lva_score(_pos, mv); });
+    _stage = pick_stage::captures;
+    [[fallthrough]];
+
+  case pick_stage::captures:
+    while (const auto mv{_moves.pick_next()}) {
+      if (*mv != _hash_move) {
+        return mv;
+      }
+    }
+    _stage = pick_stage::killers;
+    [[fallthrough]];
+
+  case pick_stage::killers:
+    while (_n_killers_picked < _killers.size()) {
+      const auto prev_killers_end{_killers.begin() + _n_killers_picked};
+      const auto killer{_killers[_n_killers_picked++]};
+      const auto is_repeated{
+          std::find(_killers.begin(), prev_killers_end, killer) !=
+          prev_killers_end};
+      if ((killer != move{}) && (killer != _hash_move) && !is_repeated &&
+          !killer.is_capture() && !killer.is_promote() &&
+          _pos.is_pseudo_legal(killer)) {
+        return killer;
+      }
+    }
+    _stage = pick_stage::gen_quiets;
+    [[fallthrough]];
+
+  case pick_stage::gen_quiets:
+    // (quiet moves are not scored, they are picked in generation order)
+    _moves.clear();
+    generate_moves<move_gen_type::quiet>(_pos, _moves.get_moves());
+    _stage = pick_stage::quiets;
+    [[fallthrough]];
+
+  case pick_stage::quiets:
+    while (_n_quiets_picked < _moves.size()) {
+      const auto mv{_moves.get_moves()[_n_quiets_picked++]};
+      if (!is_hash_or_killer(mv)) {
+        return mv;
+      }
+    }
+    _stage = pick_stage::done;
+    return std::nullopt;
+
+  case pick_stage::gen_evasions:
+    generate_moves<move_gen_type::evasions>(_pos, _moves.get_moves());
+    _moves.score_moves([this](move mv) -> move_score {
+      if (mv.is_capture() || mv.is_promote()) {
+        return evasion_capture_score + mvv_lva_score(_pos, mv);
+      }
+      const auto killer_it{std::find(_killers.begin(), _killers.end(), mv)};
+      return static_cast<move_score>(_killers.end() - killer_it);
+    });
+    _stage = pick_stage::evasions;
+    [[fallthrough]];
+
+  case pick_stage::evasions:
+    while (const auto mv{_moves.pick_next()}) {
+      if (*mv != _hash_move) {
+        return mv;
+      }
+    }
+    _stage = pick_stage::done;
+    [[fallthrough]];
+
+  case pick_stage::done:
+    return std::nullopt;
+  }
+
+  assert(false);
+  return std::nullopt;
+}
+
+pick_stage move_picker::get_stage() const noexcept { return _stage; }
+
+bool move_picker::is_hash_or_killer(move mv) const noexcept {
+  return (mv == _hash_move) ||
+         (std::find(_killers.begin(), _killers.end(), mv) != _killers.end());
+}
+
+} // namespace mpham_chess
@@ -0,0 +1,241 @@
+// Perft runner: streams EPD perft suites (e.g. tests/*.epd) and checks every
+// `;Dn <nodes>` entry, running positions in parallel. Exits with 1 if a count
+// does not match or a line is malformed.
+//
+// usage: perft_runner [--threads N] [--max-depth D] [--copy-make] <file.epd>...
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/perft.hpp"
+#include "mpham_chess/utils.hpp"
+
+#include "detail/thread_pool.hpp"
+
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+using namespace mpham_chess;
+
+namespace {
+
+struct epd_perft {
+  std::string _fen{};
+  std::vector<std::pair<unsigned int, std::size_t>> _depth_nodes{};
+};
+
+struct runner_totals {
+  std::atomic<std::size_t> _n_positions{0};
+  std::atomic<std::size_t> _n_failed{0};
+  // (lines that could not be parsed, these fail the run as well)
+  std::atomic<std::size_t> _n_malformed{0};
+  std::atomic<std::size_t> _nodes{0};
+};
+
+template <typename int_t>
+[[nodiscard]] std::optional<int_t> parse_int(std::string_view sv) noexcept {
+  int_t value{};
+  const auto *const sv_end{sv.data() + sv.size()};
+  const auto [ptr, ec]{std::from_chars(sv.data(), sv_end, value)};
+  if (ec != std::errc{} || ptr != sv_end) {
+    return std::nullopt;
+  }
+  return value;
+}
+
+[[nodiscard]] std::string_view trim(std::string_view sv) noexcept {
+  const auto first{sv.find_first_not_of(" \t\r\n")};
+  if (first == std::string_view::npos) {
+    return {};
+  }
+  const auto last{sv.find_last_not_of(" \t\r\n")};
+  return sv.substr(first, last - first + 1);
+}
+
+[[nodiscard]] std::optional<epd_perft>
+parse_epd_line(std::string_view line, unsigned int max_depth) noexcept {
+  // "{FEN} ;D1 {NODES_1} ;D2 {NODES_2} ;[...] ;D[N] {NODES_N}"
+  const auto fields{utils::str::split_string<";">(line)};
+  if (fields.size() < 2) {
+    // (no perft entries, e.g. a truncated line)
+    return std::nullopt;
+  }
+  epd_perft epd{std::string{trim(fields[0])}, {}};
+  for (std::size_t ind{1}; ind < fields.size(); ind++) {
+    const auto depth_nodes{utils::str::split_string<" ">(trim(fields[ind]))};
+    if (depth_nodes.size() != 2 || depth_nodes[0].size() < 2 ||
+        depth_nodes[0].front() != 'D') {
+      return std::nullopt;
+    }
+
+    const auto depth{parse_int<unsigned int>(depth_nodes[0].substr(1))};
+    const auto nodes{parse_int<std::size_t>(depth_nodes[1])};
+    if (!depth || !nodes) {
+      return std::nullopt;
+    }
+    if (*depth <= max_depth) {
+      epd._depth_nodes.emplace_back(*depth, *nodes);
+    }
+  }
+
+  return epd;
+}
+
+template <traversal trav>
+void run_epd_perft(const epd_perft &epd, std::size_t position_ind,
+                   runner_totals &totals, std::mutex &output_mutex) noexcept {
+  unsigned int depth{0};
+  for (const auto &[d, nodes] : epd._depth_nodes) {
+    depth = std::max(depth, d);
+  }
+
+  // one perft to the deepest depth checks every shallower depth as well
+  board pos{epd._fen};
+  const auto start{std::chrono::steady_clock::now()};
+  const auto perft_res{perft<perft_stat::ply_nodes, trav>(pos, depth)};
+  const auto stop{std::chrono::steady_clock::now()};
+  const auto secs{std::chrono::duration<double>(stop - start).count()};
+
+  std::ostringstream failures{};
+  for (const auto &[d, nodes] : epd._depth_nodes) {
+    if (perft_res._nodes[d] != nodes) {
+      failures << "    D" << d << ": expected " << nodes << ", got "
+               << perft_res._nodes[d] << '\n';
+    }
+  }
+  const auto is_ok{failures.view().empty()};
+
+  totals._n_positions.fetch_add(1, std::memory_order_relaxed);
+  totals._nodes.fetch_add(perft_res._nodes[depth], std::memory_order_relaxed);
+  if (!is_ok) {
+    totals._n_failed.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  std::lock_guard lock{output_mutex};
+  std::cout << std::setw(5) << position_ind
+            << (is_ok ? "  ok    " : "  FAIL  ") << 'D' << depth
+            << std::setw(14) << perft_res._nodes[depth] << std::fixed
+            << std::setprecision(3) << std::setw(10) << secs << " s"
+            << std::setprecision(2) << std::setw(10)
+            << (perft_res._nodes[depth] / secs / 1e6) << " Mnps  "
+            << epd._fen << '\n'
+            << failures.view();
+}
+
+void print_usage() noexcept {
+  std::cerr << "usage: perft_runner [--threads N] [--max-depth D] "
+               "[--copy-make] <file.epd>...\n";
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n_threads{std::thread::hardware_concurrency()};
+  unsigned int max_depth{~0u};
+  bool copy_make{false};
+  std::vector<std::string> epd_files{};
+
+  for (int arg_ind{1}; arg_ind < argc; arg_ind++) {
+    const std::string_view arg{argv[arg_ind]};
+    if ((arg == "--threads" || arg == "--max-depth") && arg_ind + 1 < argc) {
+      const std::string_view value{argv[++arg_ind]};
+      const auto parsed{parse_int<unsigned int>(value)};
+      if (!parsed) {
+        print_usage();
+        return 2;
+      }
+      if (arg == "--threads") {
+        n_threads = *parsed;
+      } else {
+        max_depth = *parsed;
+      }
+    } else if (arg == "--copy-make") {
+      copy_make = true;
+    } else if (arg.starts_with("--")) {
+      print_usage();
+      return 2;
+    } else {
+      epd_files.emplace_back(arg);
+    }
+  }
+  if (epd_files.empty()) {
+    print_usage();
+    return 2;
+  }
+
+  runner_totals totals{};
+  std::mutex output_mutex{};
+  std::size_t n_submitted{0};
+
+  const auto start{std::chrono::steady_clock::now()};
+  {
+    // positions are submitted while the files are still being read
+    detail::thread_pool pool{n_threads};
+    for (const auto &epd_file : epd_files) {
+      std::ifstream epd_stream{epd_file};
+      if (!epd_stream) {
+        std::cerr << "failed to open " << epd_file << '\n';
+        return 2;
+      }
+
+      std::string line{};
+      while (std::getline(epd_stream, line)) {
+        const auto trimmed_line{trim(line)};
+        if (trimmed_line.empty() || trimmed_line.front() == '#') {
+          continue;
+        }
+
+        auto epd{parse_epd_line(trimmed_line, max_depth)};
+        if (!epd) {
+          std::lock_guard lock{output_mutex};
+          std::cerr << "skipping malformed line: " << trimmed_line << '\n';
+          totals._n_malformed.fetch_add(1, std::memory_order_relaxed);
+          continue;
+        }
+        if (epd->_depth_nodes.empty()) {
+          continue;
+        }
+
+        const auto position_ind{n_submitted++};
+        pool.submit([epd{std::move(*epd)}, position_ind, copy_make, &totals,
+                     &output_mutex](std::size_t) {
+          if (copy_make) {
+            run_epd_perft<traversal::copy_make>(epd, position_ind, totals,
+                                                output_mutex);
+          } else {
+            run_epd_perft<traversal::make_unmake>(epd, position_ind, totals,
+                                                  output_mutex);
+          }
+        });
+      }
+    }
+    pool.wait();
+  }
+  const auto stop{std::chrono::steady_clock::now()};
+  const auto secs{std::chrono::duration<double>(stop - start).count()};
+
+  const auto nodes{totals._nodes.load()};
+  std::cout << "\npositions: " << totals._n_positions.load()
+            << "\nfailed:    " << totals._n_failed.load()
+            << "\nmalformed: " << totals._n_malformed.load()
+            << "\nnodes:     " << nodes << "\ntime:      " << std::fixed
+            << std::setprecision(3) << secs << " s"
+            << "\nnps:       "
+            << (secs > 0 ? static_cast<std::size_t>(nodes / secs) : 0)
+            << '\n';
+
+  return (totals._n_failed.load() == 0 && totals._n_malformed.load() == 0)
+             ? 0
+             : 1;
+}
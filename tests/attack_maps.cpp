@@ -0,0 +1,39 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "mpham_chess/bitboard.hpp"
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/constants.hpp"
+#include "mpham_chess/enums.hpp"
+
+#include "tree_walk.hpp"
+using namespace mpham_chess;
+
+namespace {
+
+bool attack_maps_match(const board &pos) {
+  // attack maps (incremental or recomputed) against `attacks_to` per square
+  for (auto c : {color::white, color::black}) {
+    const auto attacked_bb{(c == color::white)
+                               ? pos.attacks_by_color<color::white>()
+                               : pos.attacks_by_color<color::black>()};
+    for (int sq_ind{0}; sq_ind < constants::n_squares; sq_ind++) {
+      const square sq{sq_ind};
+      const auto attackers{pos.attacks_to(sq) & pos.get_color_bb(c)};
+      if (pos.get_n_attackers(c, sq) != attackers.bit_count() ||
+          !(attacked_bb & bitboard{sq}) != attackers.is_empty()) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+TEST_CASE("Attack maps match recomputation after do/undo",
+          "[board][attack_maps]") {
+  for (const auto fen : test_utils::walk_fens) {
+    board pos{fen};
+    CHECK(test_utils::n_walk_mismatches(pos, 3, attack_maps_match) == 0);
+  }
+}
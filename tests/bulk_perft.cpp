@@ -0,0 +1,31 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/perft.hpp"
+using namespace mpham_chess;
+
+TEST_CASE("Bulk Perft(5): r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/"
+          "PPPBBPPP/R3K2R w KQkq - 0 1",
+          "[perft][bulk]") {
+  board pos{
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"};
+
+  CHECK(perft_nodes(pos, 5) == 193'690'690);
+  CHECK(perft_nodes<false>(pos, 4) == 4'085'603);
+}
+
+TEST_CASE("Bulk Perft(6): 8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+          "[perft][bulk]") {
+  // en passant discovered check along the rank
+  board pos{"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1"};
+
+  CHECK(perft_nodes(pos, 6) == 11'030'083);
+}
+
+TEST_CASE("Bulk Perft(5): bqnb1rkr/pp3ppp/3ppn2/2p5/5P2/P2P4/NPP1P1PP/"
+          "BQ1BNRKR w HFhf - 2 9",
+          "[perft][bulk][chess960]") {
+  board pos{"bqnb1rkr/pp3ppp/3ppn2/2p5/5P2/P2P4/NPP1P1PP/BQ1BNRKR w HFhf - 2 9"};
+
+  CHECK(perft_nodes(pos, 5) == 8'146'062);
+}
@@ -0,0 +1,160 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <utility>
+
+#include "mpham_chess/attacks.hpp"
+#include "mpham_chess/bitboard.hpp"
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/constants.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/movegen.hpp"
+#include "mpham_chess/movelist.hpp"
+
+#include "tree_walk.hpp"
+using namespace mpham_chess;
+
+namespace {
+
+bitboard king_blockers(const board &pos, color c) {
+  // the pieces (of either color) whose removal exposes the king of `c` to an
+  // enemy slider
+  const square king_sq{pos.get_piece_bb(c, piece_type::king)};
+  const auto queens{pos.get_piece_bb(~c, piece_type::queen)};
+  const auto bishops{pos.get_piece_bb(~c, piece_type::bishop) | queens};
+  const auto rooks{pos.get_piece_bb(~c, piece_type::rook) | queens};
+  const auto slider_attackers{[&](bitboard occupied) {
+    return (attacks::slider_attacks<piece_type::bishop>(king_sq, occupied) &
+            bishops) |
+           (attacks::slider_attacks<piece_type::rook>(king_sq, occupied) &
+            rooks);
+  }};
+
+  const auto occupied{pos.get_occupied_bb()};
+  const auto attackers{slider_attackers(occupied)};
+  auto blockers{constants::bb::empty};
+  for (int sq_ind{0}; sq_ind < constants::n_squares; sq_ind++) {
+    const bitboard sq_bb{square{sq_ind}};
+    if ((occupied & sq_bb) && (sq_ind != std::to_underlying(king_sq)) &&
+        (slider_attackers(occupied & ~sq_bb) & ~attackers)) {
+      blockers |= sq_bb;
+    }
+  }
+  return blockers;
+}
+
+bool check_info_matches(const board &pos) {
+  // cached checkers, king blockers (both colors) and check squares against
+  // recomputation
+  for (auto c : {color::white, color::black}) {
+    const auto blockers{king_blockers(pos, c)};
+    if (pos.get_king_blockers_bb(c) != blockers ||
+        pos.get_pinned_bb(c) != (blockers & pos.get_color_bb(c))) {
+      return false;
+    }
+  }
+
+  const auto side{pos.get_side_to_move()};
+  const square king_sq{pos.get_piece_bb(side, piece_type::king)};
+  const auto checkers{pos.attacks_to(king_sq) & pos.get_color_bb(~side)};
+  if (pos.get_checkers_bb() != checkers || pos.is_check() != !!checkers) {
+    return false;
+  }
+
+  const auto enemy_king_bb{pos.get_piece_bb(~side, piece_type::king)};
+  const auto occupied{pos.get_occupied_bb()};
+  for (int sq_ind{0}; sq_ind < constants::n_squares; sq_ind++) {
+    const square sq{sq_ind};
+    const auto pawn_attacks{(side == color::white)
+                                ? attacks::pawn_attacks<color::white>(sq)
+                                : attacks::pawn_attacks<color::black>(sq)};
+    const bool gives_check[]{
+        !!(pawn_attacks & enemy_king_bb),
+        !!(attacks::knight_attacks(sq) & enemy_king_bb),
+        !!(attacks::slider_attacks<piece_type::bishop>(sq, occupied) &
+           enemy_king_bb),
+        !!(attacks::slider_attacks<piece_type::rook>(sq, occupied) &
+           enemy_king_bb),
+        !!(attacks::slider_attacks<piece_type::queen>(sq, occupied) &
+           enemy_king_bb)};
+    for (auto pt : {piece_type::pawn, piece_type::knight, piece_type::bishop,
+                    piece_type::rook, piece_type::queen}) {
+      const auto is_check_sq{!!(pos.get_check_sqs_bb(pt) & bitboard{sq})};
+      if (is_check_sq != gives_check[std::to_underlying(pt)]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+struct check_info_values {
+  bitboard _checkers{};
+  std::array<bitboard, constants::n_colors> _king_blockers{};
+  std::array<bitboard, constants::n_colors> _pinned{};
+  std::array<bitboard, constants::n_piece_types - 1> _check_sqs{};
+
+  [[nodiscard]] bool operator==(const check_info_values &) const = default;
+};
+
+check_info_values query_check_info(const board &pos) {
+  // (fills the caches)
+  check_info_values values{pos.get_checkers_bb(), {}, {}, {}};
+  for (auto c : {color::white, color::black}) {
+    values._king_blockers[std::to_underlying(c)] = pos.get_king_blockers_bb(c);
+    values._pinned[std::to_underlying(c)] = pos.get_pinned_bb(c);
+  }
+  for (auto pt : {piece_type::pawn, piece_type::knight, piece_type::bishop,
+                  piece_type::rook, piece_type::queen}) {
+    values._check_sqs[std::to_underlying(pt)] = pos.get_check_sqs_bb(pt);
+  }
+  return values;
+}
+
+} // namespace
+
+TEST_CASE("Cached check info matches recomputation after do/undo",
+          "[board][check_info]") {
+  for (const auto fen : test_utils::walk_fens) {
+    board pos{fen};
+    CHECK(test_utils::n_walk_mismatches(pos, 3, check_info_matches) == 0);
+  }
+}
+
+TEST_CASE("Cached check info is the same after undoing a move",
+          "[board][check_info]") {
+  // the caches are filled before the move and in the child position, the
+  // values queried after the undo must be the ones from before the move
+  for (const auto fen : test_utils::walk_fens) {
+    board pos{fen};
+    const auto before{query_check_info(pos)};
+
+    move_list mvlist{};
+    generate_moves<move_gen_type::legal>(pos, mvlist);
+    for (auto mv : mvlist) {
+      static_cast<void>(query_check_info(pos));
+      state_info prev_state{};
+      pos.do_move(mv, prev_state);
+      static_cast<void>(query_check_info(pos));
+      pos.undo_move(mv, prev_state);
+      CHECK(query_check_info(pos) == before);
+
+      undo_stack undo{};
+      pos.do_move(mv, undo);
+      static_cast<void>(query_check_info(pos));
+      pos.undo_move(undo);
+      CHECK(query_check_info(pos) == before);
+    }
+  }
+}
+
+TEST_CASE("Cached king blockers: pins and discovered check candidates",
+          "[board][check_info]") {
+  // e2 bishop pinned by the e8 rook, g5 knight blocks the g1 rook from the
+  // black king
+  board pos{"4r1k1/8/8/6N1/8/8/4B3/4K1R1 w - - 0 1"};
+  CHECK(pos.get_pinned_bb(color::white) == bitboard{square::e2});
+  CHECK(pos.get_king_blockers_bb(color::white) == bitboard{square::e2});
+  CHECK(pos.get_pinned_bb(color::black).is_empty());
+  CHECK(pos.get_king_blockers_bb(color::black) == bitboard{square::g5});
+}
@@ -0,0 +1,38 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/perft.hpp"
+#include "mpham_chess/perft_table.hpp"
+using namespace mpham_chess;
+
+TEST_CASE("Copy-make Perft(4): r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/"
+          "Pp1P2PP/R2Q1RK1 w kq - 0 1",
+          "[perft][copy_make]") {
+  board pos{"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1"};
+  const auto fen{pos.to_fen()};
+
+  const auto depth{4};
+  const auto make_unmake_res{perft(pos, depth)};
+  const auto copy_make_res{
+      perft<perft_stat::all, traversal::copy_make>(pos, depth)};
+  CHECK(copy_make_res._nodes == make_unmake_res._nodes);
+  CHECK(copy_make_res._captures == make_unmake_res._captures);
+  CHECK(copy_make_res._checks == make_unmake_res._checks);
+  CHECK(copy_make_res._divide_nodes == make_unmake_res._divide_nodes);
+  CHECK(pos.to_fen() == fen);
+}
+
+TEST_CASE("Copy-make Perft(5): bqnb1rkr/pp3ppp/3ppn2/2p5/5P2/P2P4/NPP1P1PP/"
+          "BQ1BNRKR w HFhf - 2 9",
+          "[perft][copy_make][chess960]") {
+  board pos{"bqnb1rkr/pp3ppp/3ppn2/2p5/5P2/P2P4/NPP1P1PP/BQ1BNRKR w HFhf - 2 9"};
+  perft_table table{16};
+
+  const auto depth{5};
+  CHECK(perft_nodes<true, traversal::copy_make>(pos, depth) == 8'146'062);
+  CHECK(perft_nodes<false, traversal::copy_make>(pos, 4) == 326'672);
+  const auto hashed_res{
+      perft<perft_stat::divide, traversal::copy_make>(pos, depth, table)};
+  CHECK(hashed_res._nodes[depth] == 8'146'062);
+}
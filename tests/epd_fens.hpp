@@ -0,0 +1,32 @@
+#pragma once
+
+#include <array>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace test_utils {
+
+// (file name, Shredder-FEN castling) of the EPD suites in tests/
+inline constexpr std::array<std::pair<std::string_view, bool>, 2> epd_suites{
+    std::pair{"roce_testsuite_perft_fens.epd", false},
+    std::pair{"andygrant_ethereal_chess960_perft_fens.epd", true}};
+
+inline std::vector<std::string> read_epd_fens(std::string_view file_name) {
+  // the FEN part (before the first ';') of every line of an EPD suite
+  std::ifstream epd{std::string{MPHAM_CHESS_TESTS_DIR} + '/' +
+                    std::string{file_name}};
+  std::vector<std::string> fens{};
+  for (std::string line{}; std::getline(epd, line);) {
+    const auto fen{line.substr(0, line.find(';'))};
+    const auto fen_end{fen.find_last_not_of(' ')};
+    if (fen_end != std::string::npos) {
+      fens.push_back(fen.substr(0, fen_end + 1));
+    }
+  }
+  return fens;
+}
+
+} // namespace test_utils
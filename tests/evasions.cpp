@@ -0,0 +1,142 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/move.hpp"
+#include "mpham_chess/movegen.hpp"
+#include "mpham_chess/movelist.hpp"
+#include "mpham_chess/perft.hpp"
+#include "mpham_chess/perft_table.hpp"
+#include "mpham_chess/utils.hpp"
+
+#include "epd_fens.hpp"
+using namespace mpham_chess;
+
+namespace {
+
+std::vector<move> sorted_moves(const move_list &mvlist) {
+  std::vector<move> mvs{mvlist.begin(), mvlist.end()};
+  std::ranges::sort(mvs, [](move lhs, move rhs) {
+    return std::pair{lhs.get_from_square(), lhs.get_to_square()} <
+               std::pair{rhs.get_from_square(), rhs.get_to_square()} ||
+           (std::pair{lhs.get_from_square(), lhs.get_to_square()} ==
+                std::pair{rhs.get_from_square(), rhs.get_to_square()} &&
+            lhs.get_flags() < rhs.get_flags());
+  });
+  return mvs;
+}
+
+std::size_t reference_perft(board &pos, unsigned int depth) {
+  // pseudolegal moves filtered by playing them, independent of the legal and
+  // evasion generators
+  if (depth == 0) {
+    return 1;
+  }
+  move_list mvlist{};
+  generate_moves<move_gen_type::pseudolegal>(pos, mvlist);
+  std::size_t nodes{0};
+  for (auto mv : mvlist) {
+    state_info prev_state{};
+    pos.do_move(mv, prev_state);
+    if (!pos.is_check<false>()) {
+      nodes += reference_perft(pos, depth - 1);
+    }
+    pos.undo_move(mv, prev_state);
+  }
+  return nodes;
+}
+
+std::vector<board> checked_positions(std::string_view file_name,
+                                     bool use_shredder_fen) {
+  // the positions in check among the suite positions and their children
+  std::vector<board> checked_poss{};
+  for (const auto &fen : test_utils::read_epd_fens(file_name)) {
+    board pos{fen, use_shredder_fen};
+    if (pos.is_check()) {
+      checked_poss.push_back(pos);
+    }
+    move_list mvlist{};
+    generate_moves<move_gen_type::legal>(pos, mvlist);
+    for (auto mv : mvlist) {
+      state_info prev_state{};
+      pos.do_move(mv, prev_state);
+      if (pos.is_check()) {
+        checked_poss.push_back(pos);
+      }
+      pos.undo_move(mv, prev_state);
+    }
+  }
+  return checked_poss;
+}
+
+} // namespace
+
+TEST_CASE("Evasions are the legal moves in check", "[movegen][evasions]") {
+  for (const auto [file_name, use_shredder_fen] : test_utils::epd_suites) {
+    const auto checked_poss{checked_positions(file_name, use_shredder_fen)};
+    REQUIRE(!checked_poss.empty());
+
+    for (const auto &pos : checked_poss) {
+      move_list legal_mvlist{};
+      generate_moves<move_gen_type::legal>(pos, legal_mvlist);
+      move_list evasion_mvlist{};
+      const auto n_evasions{
+          generate_moves<move_gen_type::evasions>(pos, evasion_mvlist)};
+
+      INFO(pos.to_fen());
+      CHECK(n_evasions == evasion_mvlist.size());
+      CHECK(sorted_moves(evasion_mvlist) == sorted_moves(legal_mvlist));
+      if (pos.get_checkers_bb().bit_count() > 1) {
+        CHECK(std::ranges::all_of(evasion_mvlist, [&pos](move mv) {
+          return pos.get_piece_on_sq(mv.get_from_square()) ==
+                 utils::make_piece(pos.get_side_to_move(), piece_type::king);
+        }));
+      }
+    }
+  }
+}
+
+TEST_CASE("Perft from positions in check", "[perft][evasions]") {
+  // single check (blocks, captures, enpassant capture of the checker), double
+  // check and checks against pinned pieces
+  for (const std::string_view fen :
+       {"4k3/8/8/8/1b6/3n4/8/4K3 w - - 0 1",
+        "8/8/8/2k5/3Pp3/8/8/4K3 b - d3 0 1",
+        "4k3/8/8/8/1b6/8/3N4/3QK2r w - - 0 1",
+        "r3k2r/p1pp1pb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBqPPP/R3K2R w KQkq - 0 2",
+        "rnb1kbnr/pppp1ppp/8/4p3/6Pq/5P2/PPPPP2P/RNBQKBNR w KQkq - 1 3"}) {
+    board pos{fen};
+    REQUIRE(pos.is_check());
+    constexpr unsigned int depth{4};
+
+    INFO(fen);
+    const auto expected{reference_perft(pos, depth)};
+    CHECK(perft<perft_stat::ply_nodes>(pos, depth)._nodes[depth] == expected);
+    CHECK(perft_nodes<true>(pos, depth) == expected);
+    CHECK(perft_nodes<false, traversal::copy_make>(pos, depth) == expected);
+
+    perft_table table{16};
+    CHECK(perft<perft_stat::divide>(pos, depth, table)._nodes[depth] ==
+          expected);
+  }
+}
+
+TEST_CASE("Perft below the checked suite positions", "[perft][evasions]") {
+  // (perft below each checked child of the suite positions)
+  auto checked_poss{
+      checked_positions("roce_testsuite_perft_fens.epd", false)};
+  REQUIRE(!checked_poss.empty());
+
+  for (auto &pos : checked_poss) {
+    constexpr unsigned int depth{2};
+    INFO(pos.to_fen());
+    CHECK(perft_nodes<true>(pos, depth) == reference_perft(pos, depth));
+  }
+}
@@ -0,0 +1,44 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <initializer_list>
+#include <string_view>
+#include <utility>
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/constants.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/movegen.hpp"
+#include "mpham_chess/movelist.hpp"
+
+#include "epd_fens.hpp"
+#include "positions.hpp"
+using namespace mpham_chess;
+
+TEST_CASE("FENs of the EPD suites round trip", "[board][fen]") {
+  for (const auto [file_name, use_shredder_fen] : test_utils::epd_suites) {
+    const auto fens{test_utils::read_epd_fens(file_name)};
+    REQUIRE(!fens.empty());
+
+    // reloading over the previous position leaves nothing behind
+    board reused_pos{constants::start_pos_fen, use_shredder_fen};
+    for (const auto &fen : fens) {
+      const board pos{fen, use_shredder_fen};
+      fen_buffer buf{};
+      CHECK(pos.write_fen(buf) == fen);
+      CHECK(pos.to_fen() == fen);
+
+      reused_pos.load_fen(fen);
+      CHECK(test_utils::is_same_position(reused_pos, pos));
+
+      for (const auto &child_pos : test_utils::child_positions(pos)) {
+        const board loaded_pos{child_pos.write_fen(buf), use_shredder_fen};
+        CHECK(test_utils::is_same_position(loaded_pos, child_pos));
+      }
+    }
+  }
+}
+
+TEST_CASE("FEN fields may be separated by several spaces", "[board][fen]") {
+  const board pos{"  r3k2r/8/8/8/8/8/8/R3K2R   b  Kq  -  3   12 "};
+  CHECK(pos.to_fen() == "r3k2r/8/8/8/8/8/8/R3K2R b Kq - 3 12");
+}
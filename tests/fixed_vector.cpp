@@ -0,0 +1,36 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <initializer_list>
+
+#include "mpham_chess/constants.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/move.hpp"
+#include "mpham_chess/movelist.hpp"
+
+#include "detail/fixed_vector.hpp"
+using namespace mpham_chess;
+
+TEST_CASE("emplace_back returns the new element", "[fixed_vector]") {
+  detail::fixed_vector<move, 4> init_mvlist{};
+  move_list mvlist{};
+  CHECK(mvlist.capacity() == constants::max_moves);
+
+  for (auto to_sq : {square::e3, square::e4}) {
+    const move mv{square::e2, to_sq, constants::move::flags::quiet};
+    auto &init_mv{init_mvlist.emplace_back(square::e2, to_sq,
+                                           constants::move::flags::quiet)};
+    auto &mv_ref{
+        mvlist.emplace_back(square::e2, to_sq, constants::move::flags::quiet)};
+    CHECK(init_mv == mv);
+    CHECK(&init_mv == &init_mvlist.back());
+    CHECK(mv_ref == mv);
+    CHECK(&mv_ref == &mvlist.back());
+  }
+  CHECK(mvlist.size() == 2);
+
+  // copies only hold the constructed elements
+  const move_list mvlist_copy{mvlist};
+  CHECK(std::equal(mvlist_copy.begin(), mvlist_copy.end(), mvlist.begin(),
+                   mvlist.end()));
+}
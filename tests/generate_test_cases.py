@@ -13,7 +13,7 @@ TEST_FILE_HEADER = '''// Autogenerated test file
 // clang-format off
 #include <catch2/catch_test_macros.hpp>
 
-#include <array>
+#include <vector>
 
 #include "mpham_chess/board.hpp"
 #include "mpham_chess/perft.hpp"
@@ -27,7 +27,7 @@ def make_test_case(
     test_case_tags: list[str]
 ) -> str:
     # "{FEN} ;D1 {NODES_1} ;D2 {NODES_2} ;[...] ;D[N] {NODES_N}"
-    epd_fields = perft_fen_epd.split(' ;')
+    epd_fields = perft_fen_epd.strip().split(' ;')
 
     fen, node_fields = epd_fields[0], epd_fields[1:]
     assert all([field[0] == 'D' for field in node_fields])
@@ -47,8 +47,8 @@ def make_test_case(
     test_case_str += (
         f'\tboard pos{{"{fen}"}};\n'
         f'\tconst auto depth{{{depths[-1]}}};\n'
-        f'\tconst auto perft_res{{perft<depth>(pos)}};\n'
-        f'\tconst std::array<std::size_t, depth + 1> nodes{{{", ".join(["1"] + nodes)}}};\n'
+        f'\tconst auto perft_res{{perft<perft_stat::ply_nodes>(pos, depth)}};\n'
+        f'\tconst std::vector<std::size_t> nodes{{{", ".join(["1"] + nodes)}}};\n'
         f'\tCHECK(perft_res._nodes == nodes);\n'
         '}\n\n'
     )
@@ -0,0 +1,56 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/perft.hpp"
+#include "mpham_chess/perft_table.hpp"
+using namespace mpham_chess;
+
+TEST_CASE("Hashed Perft(5): r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/"
+          "PPPBBPPP/R3K2R w KQkq - 0 1",
+          "[perft][hashed]") {
+  board pos{
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"};
+  perft_table table{16};
+
+  const auto depth{5};
+  const auto perft_res{perft(pos, depth, table)};
+  CHECK(perft_res._nodes[depth] == 193'690'690);
+
+  // second run is (mostly) served from the table
+  const auto rerun_res{perft(pos, depth, table)};
+  CHECK(rerun_res._nodes[depth] == 193'690'690);
+}
+
+TEST_CASE("Hashed Perft(7): 8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+          "[perft][hashed][parallel]") {
+  const board pos{"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1"};
+  perft_table table{16};
+
+  const auto depth{7};
+  const auto perft_res{perft(pos, depth, 4, table)};
+  CHECK(perft_res._nodes[depth] == 178'633'661);
+
+  std::size_t divide_sum{0};
+  for (const auto &[root_mv, nodes] : perft_res._divide_nodes) {
+    divide_sum += nodes;
+  }
+  CHECK(divide_sum == 178'633'661);
+}
+
+TEST_CASE("Hashed perft of Chess960 roots differing only in castle squares",
+          "[perft][hashed]") {
+  // (same hash, the castling rook is a1 in one root and b1 in the other)
+  perft_table table{16};
+  for (const auto *fen : {"4k3/8/8/8/8/8/8/RR2K2R w HA - 0 1",
+                          "4k3/8/8/8/8/8/8/RR2K2R w HB - 0 1"}) {
+    board pos{fen, true};
+    const auto depth{4};
+
+    INFO(fen);
+    const auto expected{perft_nodes(pos, depth)};
+    CHECK(perft(pos, depth, table)._nodes[depth] == expected);
+    CHECK(perft(pos, depth, 2, table)._nodes[depth] == expected);
+  }
+}
@@ -0,0 +1,112 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <string_view>
+#include <vector>
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/move.hpp"
+#include "mpham_chess/movegen.hpp"
+#include "mpham_chess/movelist.hpp"
+using namespace mpham_chess;
+
+namespace {
+
+std::vector<move> filtered_pseudolegal_moves(board &pos) {
+  move_list mvlist{};
+  generate_moves<move_gen_type::pseudolegal>(pos, mvlist);
+
+  std::vector<move> legal_mvs{};
+  for (auto mv : mvlist) {
+    state_info prev_state{};
+    pos.do_move(mv, prev_state);
+    if (!pos.is_check<false>()) {
+      legal_mvs.emplace_back(mv);
+    }
+    pos.undo_move(mv, prev_state);
+  }
+  return legal_mvs;
+}
+
+std::vector<move> legal_moves(const board &pos) {
+  move_list mvlist{};
+  generate_moves<move_gen_type::legal>(pos, mvlist);
+  return {mvlist.begin(), mvlist.end()};
+}
+
+void check_legal_moves(std::string_view fen, std::size_t n_legal_mvs) {
+  board pos{fen};
+  auto expected{filtered_pseudolegal_moves(pos)};
+  auto generated{legal_moves(pos)};
+
+  const auto by_data{[](move lhs, move rhs) {
+    return lhs.get_from_square() < rhs.get_from_square() ||
+           (lhs.get_from_square() == rhs.get_from_square() &&
+            (lhs.get_to_square() < rhs.get_to_square() ||
+             (lhs.get_to_square() == rhs.get_to_square() &&
+              lhs.get_flags() < rhs.get_flags())));
+  }};
+  std::ranges::sort(expected, by_data);
+  std::ranges::sort(generated, by_data);
+
+  CHECK(generated.size() == n_legal_mvs);
+  CHECK(generated == expected);
+}
+
+} // namespace
+
+TEST_CASE("Legal movegen: enpassant discovered check along the rank",
+          "[movegen][legal]") {
+  check_legal_moves("8/8/8/KPp4r/8/8/8/7k w - c6 0 2", 4);
+}
+
+TEST_CASE("Legal movegen: enpassant capturing the checking pawn",
+          "[movegen][legal]") {
+  check_legal_moves("8/8/8/2k5/3Pp3/8/8/4K3 b - d3 0 1", 9);
+}
+
+TEST_CASE("Legal movegen: pinned pieces and single check",
+          "[movegen][legal]") {
+  check_legal_moves(
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+      48);
+  check_legal_moves("4k3/4r3/8/8/8/8/4B3/4K3 w - - 0 1", 4);
+  check_legal_moves("4k3/8/8/8/1b6/8/3N4/3QK3 w - - 0 1", 13);
+}
+
+TEST_CASE("Legal movegen: double check", "[movegen][legal]") {
+  check_legal_moves("4k3/8/8/8/1b6/3n4/8/4K3 w - - 0 1", 3);
+}
+
+TEST_CASE("Legal movegen: Chess960 castle rook shielding the king",
+          "[movegen][legal][chess960]") {
+  // after O-O-O (Kc1, Rd1) the a1 rook attacks c1
+  check_legal_moves("1k6/8/8/8/8/8/8/rR1K4 w B - 0 1", 7);
+}
+
+TEST_CASE("Undo stack restores the position", "[board][undo]") {
+  board pos{
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"};
+  const auto fen{pos.to_fen()};
+  const auto hash{pos.get_hash()};
+
+  undo_stack undo{};
+  move_list mvlist{};
+  generate_moves<move_gen_type::legal>(pos, mvlist);
+  for (auto mv : mvlist) {
+    pos.do_move(mv, undo);
+
+    move_list child_mvlist{};
+    generate_moves<move_gen_type::legal>(pos, child_mvlist);
+    for (auto child_mv : child_mvlist) {
+      pos.do_move(child_mv, undo);
+      CHECK(undo.size() == 2);
+      pos.undo_move(undo);
+    }
+
+    pos.undo_move(undo);
+    CHECK(undo.empty());
+    CHECK(pos.get_hash() == hash);
+    CHECK(pos.to_fen() == fen);
+  }
+}
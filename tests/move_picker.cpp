@@ -0,0 +1,160 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/constants.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/move.hpp"
+#include "mpham_chess/move_picker.hpp"
+#include "mpham_chess/movegen.hpp"
+#include "mpham_chess/movelist.hpp"
+
+#include "epd_fens.hpp"
+using namespace mpham_chess;
+
+namespace {
+
+std::vector<move> pick_all(move_picker &picker) {
+  std::vector<move> mvs{};
+  while (const auto mv{picker.next_move()}) {
+    mvs.push_back(*mv);
+  }
+  return mvs;
+}
+
+bool is_same_moves(std::vector<move> mvs, const move_list &mvlist) {
+  // (as sets, every move once)
+  std::vector<move> expected{mvlist.begin(), mvlist.end()};
+  const auto by_data = [](move lhs, move rhs) {
+    return std::pair{lhs.get_from_square(), lhs.get_to_square()} <
+               std::pair{rhs.get_from_square(), rhs.get_to_square()} ||
+           (std::pair{lhs.get_from_square(), lhs.get_to_square()} ==
+                std::pair{rhs.get_from_square(), rhs.get_to_square()} &&
+            lhs.get_flags() < rhs.get_flags());
+  };
+  std::ranges::sort(mvs, by_data);
+  std::ranges::sort(expected, by_data);
+  return mvs == expected;
+}
+
+void check_picked_moves(const board &pos, move hash_move,
+                        const killer_moves &killers) {
+  // (in check: the evasions, and the hash move if it is not one)
+  move_list expected_mvlist{};
+  if (pos.is_check()) {
+    generate_moves<move_gen_type::evasions>(pos, expected_mvlist);
+    if (pos.is_pseudo_legal(hash_move) &&
+        std::ranges::find(expected_mvlist, hash_move) ==
+            expected_mvlist.end()) {
+      expected_mvlist.push_back(hash_move);
+    }
+  } else {
+    generate_moves<move_gen_type::pseudolegal>(pos, expected_mvlist);
+  }
+
+  move_picker picker{pos, hash_move, killers};
+  const auto mvs{pick_all(picker)};
+  CHECK(picker.get_stage() == pick_stage::done);
+  CHECK(is_same_moves(mvs, expected_mvlist));
+
+  // hash move, captures (best first), killers, quiets
+  std::size_t ind{0};
+  if (pos.is_pseudo_legal(hash_move)) {
+    REQUIRE(!mvs.empty());
+    CHECK(mvs[ind++] == hash_move);
+  }
+  std::optional<move_score> prev_score{};
+  for (; ind < mvs.size() && (mvs[ind].is_capture() || mvs[ind].is_promote());
+       ind++) {
+    const auto score{mvv_lva_score(pos, mvs[ind])};
+    CHECK((!prev_score || score <= *prev_score));
+    prev_score = score;
+  }
+  for (auto killer : killers) {
+    if (killer != hash_move && !killer.is_capture() && !killer.is_promote() &&
+        std::ranges::find(expected_mvlist, killer) != expected_mvlist.end() &&
+        std::ranges::find(mvs.begin(), mvs.begin() + ind, killer) ==
+            mvs.begin() + ind) {
+      REQUIRE(ind < mvs.size());
+      CHECK(mvs[ind++] == killer);
+    }
+  }
+  for (; ind < mvs.size(); ind++) {
+    CHECK(!mvs[ind].is_capture());
+    CHECK(!mvs[ind].is_promote());
+  }
+}
+
+} // namespace
+
+TEST_CASE("Picked moves are the pseudolegal moves (evasions in check) in "
+          "stage order",
+          "[move_picker]") {
+  for (const auto [file_name, use_shredder_fen] : test_utils::epd_suites) {
+    const auto fens{test_utils::read_epd_fens(file_name)};
+    REQUIRE(!fens.empty());
+
+    for (const auto &fen : fens) {
+      const board pos{fen, use_shredder_fen};
+      check_picked_moves(pos, move{}, {});
+
+      // hash and killer moves taken from the generated moves (first quiet
+      // and capture), from the start position (often not pseudolegal here)
+      // and a repeated killer
+      move_list mvlist{};
+      generate_moves<move_gen_type::pseudolegal>(pos, mvlist);
+      const auto quiet_it{std::ranges::find_if(mvlist, [](move mv) {
+        return !mv.is_capture() && !mv.is_promote();
+      })};
+      const auto capture_it{std::ranges::find_if(
+          mvlist, [](move mv) { return mv.is_capture(); })};
+      const auto quiet{(quiet_it != mvlist.end()) ? *quiet_it : move{}};
+      const auto capture{(capture_it != mvlist.end()) ? *capture_it : move{}};
+      const move g1f3{square::g1, square::f3, constants::move::flags::quiet};
+      const move b8c6{square::b8, square::c6, constants::move::flags::quiet};
+
+      check_picked_moves(pos, capture, {quiet, g1f3});
+      check_picked_moves(pos, quiet, {quiet, b8c6});
+      check_picked_moves(pos, g1f3, {b8c6, b8c6});
+      check_picked_moves(pos, move{}, {capture, quiet});
+    }
+  }
+}
+
+TEST_CASE("Stages are generated only when reached", "[move_picker]") {
+  const board pos{constants::start_pos_fen};
+  const move e2e4{square::e2, square::e4,
+                  constants::move::flags::double_pawn_push};
+  const move g1f3{square::g1, square::f3, constants::move::flags::quiet};
+
+  move_picker picker{pos, e2e4, {g1f3, move{}}};
+  CHECK(picker.next_move() == e2e4);
+  CHECK(picker.get_stage() == pick_stage::gen_captures);
+  // (no captures in the start position)
+  CHECK(picker.next_move() == g1f3);
+  CHECK(picker.get_stage() == pick_stage::killers);
+  CHECK(pick_all(picker).size() == 18);
+}
+
+TEST_CASE("In check only the evasions are picked", "[move_picker][evasions]") {
+  // (Bb4+, the quiet h2h3 does not block)
+  const board pos{"4k3/8/8/8/1b6/8/4N2P/4K3 w - - 0 1"};
+  const move h2h3{square::h2, square::h3, constants::move::flags::quiet};
+  const move e2c3{square::e2, square::c3, constants::move::flags::quiet};
+
+  move_picker picker{pos, h2h3, {e2c3, move{}}};
+  CHECK(picker.next_move() == h2h3);
+  CHECK(picker.get_stage() == pick_stage::gen_evasions);
+  CHECK(picker.next_move() == e2c3);
+  CHECK(picker.get_stage() == pick_stage::evasions);
+
+  move_list evasion_mvlist{};
+  generate_moves<move_gen_type::evasions>(pos, evasion_mvlist);
+  CHECK(pick_all(picker).size() == evasion_mvlist.size() - 1);
+}
@@ -0,0 +1,98 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/constants.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/move.hpp"
+#include "mpham_chess/movegen.hpp"
+#include "mpham_chess/movelist.hpp"
+using namespace mpham_chess;
+
+namespace {
+
+constexpr std::array<std::string_view, 6> predicate_fens{
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+    "bqnb1rkr/pp3ppp/3ppn2/2p5/5P2/P2P4/NPP1P1PP/BQ1BNRKR w HFhf - 2 9",
+    "8/8/8/KPp4r/8/8/8/7k w - c6 0 2"};
+
+std::size_t n_predicate_mismatches(board &pos, unsigned int depth) {
+  // `is_pseudo_legal`, `is_legal` and `gives_check` against playing the move
+  move_list mvlist{};
+  generate_moves<move_gen_type::pseudolegal>(pos, mvlist);
+
+  std::size_t mismatches{0};
+  for (auto mv : mvlist) {
+    mismatches += !pos.is_pseudo_legal(mv);
+
+    const auto is_legal{pos.is_legal(mv)};
+    const auto gives_check{is_legal && pos.gives_check(mv)};
+    state_info prev_state{};
+    pos.do_move(mv, prev_state);
+    const auto is_legal_played{!pos.is_check<false>()};
+    mismatches += (is_legal != is_legal_played);
+    if (is_legal_played) {
+      mismatches += (gives_check != pos.is_check());
+      if (depth > 1) {
+        mismatches += n_predicate_mismatches(pos, depth - 1);
+      }
+    }
+    pos.undo_move(mv, prev_state);
+  }
+  return mismatches;
+}
+
+std::size_t n_pseudo_legal_mismatches(const board &pos) {
+  // every encodable move is pseudolegal iff it is generated
+  move_list mvlist{};
+  generate_moves<move_gen_type::pseudolegal>(pos, mvlist);
+
+  std::size_t mismatches{0};
+  for (int from_ind{0}; from_ind < constants::n_squares; from_ind++) {
+    for (int to_ind{0}; to_ind < constants::n_squares; to_ind++) {
+      for (move_flags flags{0}; flags < 16; flags++) {
+        if (flags == constants::move::flags::invalid_flag_1 ||
+            flags == constants::move::flags::invalid_flag_2) {
+          continue;
+        }
+        const move mv{square{from_ind}, square{to_ind}, flags};
+        const auto is_generated{std::ranges::find(mvlist, mv) != mvlist.end()};
+        mismatches += (pos.is_pseudo_legal(mv) != is_generated);
+      }
+    }
+  }
+  return mismatches;
+}
+
+} // namespace
+
+TEST_CASE("Move predicates match playing the move", "[board][predicates]") {
+  for (const auto fen : predicate_fens) {
+    board pos{fen};
+    CHECK(n_predicate_mismatches(pos, 3) == 0);
+  }
+}
+
+TEST_CASE("Pseudolegal validation of arbitrary moves", "[board][predicates]") {
+  for (const auto fen : predicate_fens) {
+    const board pos{fen};
+    CHECK(n_pseudo_legal_mismatches(pos) == 0);
+
+    // moves of the children (other side to move, different occupancy)
+    move_list mvlist{};
+    generate_moves<move_gen_type::legal>(pos, mvlist);
+    for (auto mv : mvlist) {
+      board child_pos{pos};
+      state_info prev_state{};
+      child_pos.do_move(mv, prev_state);
+      CHECK(n_pseudo_legal_mismatches(child_pos) == 0);
+    }
+  }
+}
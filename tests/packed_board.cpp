@@ -0,0 +1,58 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <initializer_list>
+#include <string_view>
+#include <utility>
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/constants.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/movegen.hpp"
+#include "mpham_chess/movelist.hpp"
+#include "mpham_chess/utils.hpp"
+
+#include "epd_fens.hpp"
+#include "positions.hpp"
+using namespace mpham_chess;
+
+TEST_CASE("Positions of the EPD suites round trip through packing",
+          "[board][packed_board]") {
+  for (const auto [file_name, use_shredder_fen] : test_utils::epd_suites) {
+    const auto fens{test_utils::read_epd_fens(file_name)};
+    REQUIRE(!fens.empty());
+
+    // unpacking over the previous position leaves nothing behind
+    board unpacked_pos{constants::start_pos_fen, use_shredder_fen};
+    for (const auto &fen : fens) {
+      const board pos{fen, use_shredder_fen};
+      unpacked_pos.unpack(pos.pack());
+      CHECK(test_utils::is_same_position(unpacked_pos, pos));
+      for (auto c : {color::white, color::black}) {
+        for (auto cs : {castle_side::king, castle_side::queen}) {
+          if (!!(pos.get_castle() & utils::make_castle_rights(c, cs))) {
+            CHECK(unpacked_pos.get_rook_castle_sq(c, cs) ==
+                  pos.get_rook_castle_sq(c, cs));
+          }
+        }
+      }
+
+      for (const auto &child_pos : test_utils::child_positions(pos)) {
+        const auto packed{child_pos.pack()};
+        unpacked_pos.unpack(packed);
+        CHECK(test_utils::is_same_position(unpacked_pos, child_pos));
+        CHECK(unpacked_pos.pack() == packed);
+      }
+    }
+  }
+}
+
+TEST_CASE("Packed counters saturate", "[board][packed_board]") {
+  const board pos{"4k3/8/8/8/8/8/8/4K3 w - - 70000 90000"};
+  const auto packed{pos.pack()};
+  CHECK(packed._rule50 == 0xFFFF);
+  CHECK(packed._movenum == 0xFFFF);
+
+  board unpacked_pos{};
+  unpacked_pos.unpack(packed);
+  CHECK(unpacked_pos.to_fen() == "4k3/8/8/8/8/8/8/4K3 w - - 65535 65535");
+}
@@ -0,0 +1,50 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/perft.hpp"
+using namespace mpham_chess;
+
+TEST_CASE("Parallel Perft(5): r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/"
+          "PPPBBPPP/R3K2R w KQkq - 0 1",
+          "[perft][parallel]") {
+  const board pos{
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"};
+
+  const auto depth{5};
+  const auto perft_res{perft(pos, depth, 4)};
+
+  const std::vector<std::size_t> nodes{
+      1, 48, 2'039, 97'862, 4'085'603, 193'690'690};
+  const std::vector<std::size_t> captures{
+      0, 8, 351, 17'102, 757'163, 35'043'416};
+  const std::vector<std::size_t> enpassants{0, 0, 1, 45, 1'929, 73'365};
+  const std::vector<std::size_t> castles{0, 2, 91, 3'162, 128'013, 4'993'637};
+  const std::vector<std::size_t> promotes{0, 0, 0, 0, 15'172, 8'392};
+  const std::vector<std::size_t> checks{0, 0, 3, 993, 25'523, 3'309'887};
+  CHECK(perft_res._nodes == nodes);
+  CHECK(perft_res._captures == captures);
+  CHECK(perft_res._enpassants == enpassants);
+  CHECK(perft_res._castles == castles);
+  CHECK(perft_res._promotes == promotes);
+  CHECK(perft_res._checks == checks);
+}
+
+TEST_CASE("Parallel Perft(4): divide matches serial perft",
+          "[perft][parallel]") {
+  board pos{"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1"};
+
+  const auto depth{4};
+  const auto serial_res{perft(pos, depth)};
+  for (std::size_t n_threads : {1, 2, 3, 8}) {
+    const auto parallel_res{perft(pos, depth, n_threads)};
+    CHECK(parallel_res._nodes == serial_res._nodes);
+    CHECK(parallel_res._captures == serial_res._captures);
+    CHECK(parallel_res._enpassants == serial_res._enpassants);
+    CHECK(parallel_res._castles == serial_res._castles);
+    CHECK(parallel_res._promotes == serial_res._promotes);
+    CHECK(parallel_res._checks == serial_res._checks);
+    CHECK(parallel_res._divide_nodes == serial_res._divide_nodes);
+  }
+}
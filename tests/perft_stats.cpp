@@ -0,0 +1,56 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/perft.hpp"
+using namespace mpham_chess;
+
+TEST_CASE("Perft stats: selected statistics match the full perft",
+          "[perft][perft_stats]") {
+  board pos{"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1"};
+
+  const auto depth{4};
+  const auto all_res{perft(pos, depth)};
+
+  const auto nodes_res{perft<perft_stat::nodes>(pos, depth)};
+  CHECK(nodes_res._nodes[depth] == 422'333);
+  CHECK(nodes_res._nodes[1] == 0);
+  CHECK(nodes_res._captures.empty());
+  CHECK(nodes_res._checks.empty());
+  CHECK(nodes_res._divide_nodes.empty());
+
+  const auto ply_nodes_res{perft<perft_stat::ply_nodes>(pos, depth)};
+  CHECK(ply_nodes_res._nodes == all_res._nodes);
+
+  const auto stats_res{
+      perft<perft_stat::captures | perft_stat::checks>(pos, depth)};
+  CHECK(stats_res._nodes[depth] == 422'333);
+  CHECK(stats_res._captures == all_res._captures);
+  CHECK(stats_res._checks == all_res._checks);
+  CHECK(stats_res._enpassants.empty());
+  CHECK(stats_res._castles.empty());
+  CHECK(stats_res._promotes.empty());
+
+  const auto divide_res{perft<perft_stat::divide>(pos, depth)};
+  CHECK(divide_res._divide_nodes == all_res._divide_nodes);
+
+  std::size_t divide_sum{0};
+  for (const auto &[root_mv, nodes] : divide_res._divide_nodes) {
+    divide_sum += nodes;
+  }
+  CHECK(divide_sum == 422'333);
+}
+
+TEST_CASE("Perft stats: depth 0 and 1", "[perft][perft_stats]") {
+  board pos{};
+
+  const auto root_res{perft(pos, 0)};
+  CHECK(root_res._nodes.size() == 1);
+  CHECK(root_res._nodes[0] == 1);
+
+  const auto leaf_res{perft(pos, 1)};
+  CHECK(leaf_res._nodes[1] == 20);
+  CHECK(leaf_res._divide_nodes.size() == 20);
+}
@@ -0,0 +1,250 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <string_view>
+#include <utility>
+
+#include "mpham_chess/attacks.hpp"
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/constants.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/move.hpp"
+#include "mpham_chess/movegen.hpp"
+#include "mpham_chess/movelist.hpp"
+#include "mpham_chess/utils.hpp"
+#include "mpham_chess/zobrist.hpp"
+using namespace mpham_chess;
+
+namespace {
+
+constexpr std::array<std::string_view, 4> hash_fens{
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    "bqnb1rkr/pp3ppp/3ppn2/2p5/5P2/P2P4/NPP1P1PP/BQ1BNRKR w HFhf - 2 9"};
+
+bool hashes_match(const board &pos, const board &expected) {
+  return pos.get_hash() == expected.get_hash() &&
+         pos.get_pawn_hash() == expected.get_pawn_hash() &&
+         pos.get_material_hash() == expected.get_material_hash() &&
+         pos.get_non_pawn_hash(color::white) ==
+             expected.get_non_pawn_hash(color::white) &&
+         pos.get_non_pawn_hash(color::black) ==
+             expected.get_non_pawn_hash(color::black);
+}
+
+std::size_t n_mismatches(board &pos, unsigned int depth) {
+  // incrementally updated hashes against the hashes of the reloaded position
+  std::size_t mismatches{!hashes_match(pos, board{pos.to_fen(), true})};
+  if (depth == 0) {
+    return mismatches;
+  }
+
+  const board before{pos};
+  move_list mvlist{};
+  generate_moves<move_gen_type::legal>(pos, mvlist);
+  for (auto mv : mvlist) {
+    state_info prev_state{};
+    pos.do_move(mv, prev_state);
+    mismatches += n_mismatches(pos, depth - 1);
+    pos.undo_move(mv, prev_state);
+    mismatches += !hashes_match(pos, before);
+  }
+  return mismatches;
+}
+
+} // namespace
+
+TEST_CASE("Pawn, material and non-pawn hashes are updated incrementally",
+          "[board][hashes]") {
+  for (const auto fen : hash_fens) {
+    board pos{fen, true};
+    CHECK(n_mismatches(pos, 3) == 0);
+  }
+}
+
+TEST_CASE("Secondary hashes only depend on their pieces", "[board][hashes]") {
+  // same pawns, different pieces
+  const board knight_pos{"4k3/pp6/8/8/8/8/PP6/4K1N1 w - - 0 1"};
+  const board bishop_pos{"4k3/pp6/8/8/8/8/PP6/4KB2 w - - 0 1"};
+  CHECK(knight_pos.get_pawn_hash() == bishop_pos.get_pawn_hash());
+  CHECK(knight_pos.get_non_pawn_hash(color::black) ==
+        bishop_pos.get_non_pawn_hash(color::black));
+  CHECK(knight_pos.get_non_pawn_hash(color::white) !=
+        bishop_pos.get_non_pawn_hash(color::white));
+  CHECK(knight_pos.get_material_hash() != bishop_pos.get_material_hash());
+
+  // same material, different squares and side to move
+  const board pos_1{"4k3/pp6/8/8/8/8/PP6/4K1N1 w - - 0 1"};
+  const board pos_2{"3k4/1p4p1/8/8/8/2N5/P4P2/6K1 b - - 0 1"};
+  CHECK(pos_1.get_material_hash() == pos_2.get_material_hash());
+  CHECK(pos_1.get_pawn_hash() != pos_2.get_pawn_hash());
+}
+
+TEST_CASE("A FEN enpassant square no pawn can capture is dropped",
+          "[board][hashes][fen]") {
+  // (as after playing the double push)
+  board played_pos{};
+  state_info prev_state{};
+  played_pos.do_move(
+      move{square::e2, square::e4, constants::move::flags::double_pawn_push},
+      prev_state);
+  const board loaded_pos{
+      "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1"};
+  CHECK(loaded_pos.get_ep_sq() == square::no_square);
+  CHECK(loaded_pos.get_hash() == played_pos.get_hash());
+  CHECK(loaded_pos.to_fen() == played_pos.to_fen());
+
+  const board capturable_pos{"8/8/2k5/8/3pP3/8/5K2/8 b - e3 0 1"};
+  CHECK(capturable_pos.get_ep_sq() == square::e3);
+  CHECK(capturable_pos.get_hash() !=
+        board{"8/8/2k5/8/3pP3/8/5K2/8 b - - 0 1"}.get_hash());
+}
+
+// the hash tables are compile time constants
+static_assert(zobrist::get_color_hash() != 0);
+
+#if defined(MPHAM_CHESS_USE_POLYGLOT_ZOBRIST)
+namespace {
+
+zobrist_hash polyglot_hash(const board &pos) {
+  // the book format definition, computed from scratch
+  const auto &random64{zobrist::polyglot::random64};
+  zobrist_hash key{0};
+  for (int sq_ind{0}; sq_ind < constants::n_squares; sq_ind++) {
+    const auto pc{pos.get_piece_on_sq(square{sq_ind})};
+    if (pc != piece::no_piece) {
+      const auto kind{2 * std::to_underlying(utils::piecetype_of(pc)) +
+                      (utils::color_of(pc) == color::white)};
+      key ^= random64[64 * kind + sq_ind];
+    }
+  }
+  const auto castle{pos.get_castle()};
+  for (auto [cr, offset] : {std::pair{castle_rights::w_king, 768},
+                            std::pair{castle_rights::w_queen, 769},
+                            std::pair{castle_rights::b_king, 770},
+                            std::pair{castle_rights::b_queen, 771}}) {
+    if (!!(castle & cr)) {
+      key ^= random64[offset];
+    }
+  }
+  // (only hashed when a pawn of the side to move can capture enpassant)
+  const auto ep_sq{pos.get_ep_sq()};
+  if (ep_sq != square::no_square) {
+    const auto side{pos.get_side_to_move()};
+    const auto ep_attackers{(side == color::white)
+                                ? attacks::pawn_attacks<color::black>(ep_sq)
+                                : attacks::pawn_attacks<color::white>(ep_sq)};
+    if (ep_attackers & pos.get_piece_bb(side, piece_type::pawn)) {
+      key ^= random64[772 + std::to_underlying(utils::file_of(ep_sq))];
+    }
+  }
+  if (pos.get_side_to_move() == color::white) {
+    key ^= random64[780];
+  }
+  return key;
+}
+
+std::size_t n_polyglot_mismatches(board &pos, unsigned int depth) {
+  std::size_t mismatches{pos.get_hash() != polyglot_hash(pos)};
+  if (depth == 0) {
+    return mismatches;
+  }
+
+  move_list mvlist{};
+  generate_moves<move_gen_type::legal>(pos, mvlist);
+  for (auto mv : mvlist) {
+    state_info prev_state{};
+    pos.do_move(mv, prev_state);
+    mismatches += n_polyglot_mismatches(pos, depth - 1);
+    pos.undo_move(mv, prev_state);
+  }
+  return mismatches;
+}
+
+} // namespace
+
+TEST_CASE("Polyglot hashes follow the book format key layout",
+          "[board][hashes][polyglot]") {
+  for (const auto fen :
+       {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+        "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1"}) {
+    board pos{fen};
+    CHECK(n_polyglot_mismatches(pos, 3) == 0);
+  }
+}
+
+TEST_CASE("Polyglot hashes match the book format reference keys",
+          "[board][hashes][polyglot]") {
+  namespace flags = constants::move::flags;
+  const auto check_line{[](std::initializer_list<move> mvs, zobrist_hash key) {
+    board pos{};
+    undo_stack undo{};
+    for (auto mv : mvs) {
+      pos.do_move(mv, undo);
+    }
+    CHECK(pos.get_hash() == key);
+  }};
+
+  CHECK(board{}.get_hash() == 0x463b96181691fc9c);
+  // (loaded directly, the e3 square is not hashed: no black pawn can capture)
+  CHECK(board{"rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1"}
+            .get_hash() == 0x823c9b50fd114196);
+  CHECK(board{"rnbqkbnr/ppp1pppp/8/3pP3/8/8/PPPP1PPP/RNBQKBNR b KQkq - 0 2"}
+            .get_hash() == 0x662fafb965db29d4);
+  CHECK(board{"rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3"}
+            .get_hash() == 0x22a48b5a8e47ff78);
+  check_line({move{square::e2, square::e4, flags::double_pawn_push}},
+             0x823c9b50fd114196);
+  check_line({move{square::e2, square::e4, flags::double_pawn_push},
+              move{square::d7, square::d5, flags::double_pawn_push}},
+             0x0756b94461c50fb0);
+  check_line({move{square::e2, square::e4, flags::double_pawn_push},
+              move{square::d7, square::d5, flags::double_pawn_push},
+              move{square::e4, square::e5, flags::quiet}},
+             0x662fafb965db29d4);
+  check_line({move{square::e2, square::e4, flags::double_pawn_push},
+              move{square::d7, square::d5, flags::double_pawn_push},
+              move{square::e4, square::e5, flags::quiet},
+              move{square::f7, square::f5, flags::double_pawn_push}},
+             0x22a48b5a8e47ff78);
+  check_line({move{square::e2, square::e4, flags::double_pawn_push},
+              move{square::d7, square::d5, flags::double_pawn_push},
+              move{square::e4, square::e5, flags::quiet},
+              move{square::f7, square::f5, flags::double_pawn_push},
+              move{square::e1, square::e2, flags::quiet}},
+             0x652a607ca3f242c1);
+  check_line({move{square::e2, square::e4, flags::double_pawn_push},
+              move{square::d7, square::d5, flags::double_pawn_push},
+              move{square::e4, square::e5, flags::quiet},
+              move{square::f7, square::f5, flags::double_pawn_push},
+              move{square::e1, square::e2, flags::quiet},
+              move{square::e8, square::f7, flags::quiet}},
+             0x00fdd303c946bdd9);
+  check_line({move{square::a2, square::a4, flags::double_pawn_push},
+              move{square::b7, square::b5, flags::double_pawn_push},
+              move{square::h2, square::h4, flags::double_pawn_push},
+              move{square::b5, square::b4, flags::quiet},
+              move{square::c2, square::c4, flags::double_pawn_push}},
+             0x3c8123ea7b067637);
+  check_line({move{square::a2, square::a4, flags::double_pawn_push},
+              move{square::b7, square::b5, flags::double_pawn_push},
+              move{square::h2, square::h4, flags::double_pawn_push},
+              move{square::b5, square::b4, flags::quiet},
+              move{square::c2, square::c4, flags::double_pawn_push},
+              move{square::b4, square::c3, flags::enpassant},
+              move{square::a1, square::a3, flags::quiet}},
+             0x5c3f9b829b279560);
+}
+#else
+TEST_CASE("Hashes are the same in every build", "[board][hashes]") {
+  // generated from fixed seeds at compile time
+  CHECK(board{}.get_hash() == 0xe8a603b4bf90d595);
+  CHECK(board{"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w "
+              "KQkq - 0 1"}
+            .get_hash() == 0x4fed2bfe7eba2ffd);
+}
+#endif
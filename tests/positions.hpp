@@ -0,0 +1,45 @@
+#pragma once
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/movegen.hpp"
+#include "mpham_chess/movelist.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace test_utils {
+
+inline bool is_same_position(const mpham_chess::board &pos,
+                             const mpham_chess::board &expected) {
+  // the FEN fields, every hash, the occupancy and the checkers
+  using mpham_chess::color;
+  mpham_chess::fen_buffer buf{};
+  mpham_chess::fen_buffer expected_buf{};
+  return pos.write_fen(buf) == expected.write_fen(expected_buf) &&
+         pos.get_hash() == expected.get_hash() &&
+         pos.get_pawn_hash() == expected.get_pawn_hash() &&
+         pos.get_material_hash() == expected.get_material_hash() &&
+         pos.get_non_pawn_hash(color::white) ==
+             expected.get_non_pawn_hash(color::white) &&
+         pos.get_non_pawn_hash(color::black) ==
+             expected.get_non_pawn_hash(color::black) &&
+         pos.get_occupied_bb() == expected.get_occupied_bb() &&
+         pos.get_checkers_bb() == expected.get_checkers_bb();
+}
+
+inline std::vector<mpham_chess::board>
+child_positions(const mpham_chess::board &pos) {
+  // the positions after each legal move (enpassant squares, counters, lost
+  // castle rights)
+  mpham_chess::move_list mvlist{};
+  mpham_chess::generate_moves<mpham_chess::move_gen_type::legal>(pos, mvlist);
+  std::vector<mpham_chess::board> children(mvlist.size(), pos);
+  for (std::size_t ind{0}; ind < mvlist.size(); ind++) {
+    mpham_chess::state_info prev_state{};
+    children[ind].do_move(mvlist[ind], prev_state);
+  }
+  return children;
+}
+
+} // namespace test_utils
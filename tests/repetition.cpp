@@ -0,0 +1,142 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <string_view>
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/constants.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/move.hpp"
+#include "mpham_chess/movegen.hpp"
+#include "mpham_chess/movelist.hpp"
+using namespace mpham_chess;
+
+namespace {
+
+constexpr std::array<std::string_view, 4> repetition_fens{
+    "8/8/3k4/2n5/8/4N3/3K4/8 w - - 0 1",
+    "4k3/8/8/8/8/8/N7/R3K3 b - - 0 1",
+    "r3k3/8/8/8/8/8/8/4K2R w Kq - 0 1",
+    "8/8/2k5/8/3pP3/8/5K2/8 b - e3 0 1"};
+
+void play(board &pos, undo_stack &undo, std::initializer_list<move> mvs) {
+  for (auto mv : mvs) {
+    pos.do_move(mv, undo);
+  }
+}
+
+bool is_any_repetition(const board &pos, const undo_stack &undo) {
+  // any earlier position, regardless of the rule50 window or side to move
+  return std::ranges::any_of(undo, [&pos](const undo_info &info) {
+    return info._state._hash == pos.get_hash();
+  });
+}
+
+bool can_repeat(board &pos, undo_stack &undo) {
+  // is there a (pseudolegal) move repeating an earlier position
+  move_list mvlist{};
+  generate_moves<move_gen_type::pseudolegal>(pos, mvlist);
+  return std::ranges::any_of(mvlist, [&pos, &undo](move mv) {
+    pos.do_move(mv, undo);
+    const auto is_repetition{pos.is_repetition(undo, undo.size() + 1)};
+    pos.undo_move(undo);
+    return is_repetition;
+  });
+}
+
+std::size_t n_mismatches(board &pos, undo_stack &undo, unsigned int depth) {
+  // (every position played is after the root)
+  const auto ply{static_cast<unsigned int>(undo.size() + 1)};
+  std::size_t mismatches{0};
+  mismatches += (pos.is_repetition(undo, ply) != is_any_repetition(pos, undo));
+  mismatches +=
+      (pos.has_upcoming_repetition(undo, ply) != can_repeat(pos, undo));
+  if (depth == 0) {
+    return mismatches;
+  }
+
+  move_list mvlist{};
+  generate_moves<move_gen_type::legal>(pos, mvlist);
+  for (auto mv : mvlist) {
+    pos.do_move(mv, undo);
+    mismatches += n_mismatches(pos, undo, depth - 1);
+    pos.undo_move(undo);
+  }
+  return mismatches;
+}
+
+} // namespace
+
+TEST_CASE("Repetitions after the root and threefold repetitions",
+          "[board][repetition]") {
+  namespace flags = constants::move::flags;
+  const auto shuffle = {move{square::g1, square::f3, flags::quiet},
+                        move{square::g8, square::f6, flags::quiet},
+                        move{square::f3, square::g1, flags::quiet},
+                        move{square::f6, square::g8, flags::quiet}};
+
+  board pos{};
+  undo_stack undo{};
+  play(pos, undo, shuffle);
+  CHECK(pos.is_repetition(undo, 5));
+  // the repeated position is the root
+  CHECK(!pos.is_repetition(undo, 4));
+  CHECK(!pos.is_repetition(undo, 0));
+
+  play(pos, undo, shuffle);
+  CHECK(pos.is_repetition(undo, 0));
+
+  // positions before a pawn move can not repeat
+  play(pos, undo,
+       {move{square::e2, square::e3, flags::quiet},
+        move{square::e7, square::e6, flags::quiet}});
+  play(pos, undo, shuffle);
+  CHECK(!pos.is_repetition(undo, 0));
+  CHECK(pos.is_repetition(undo, 5));
+}
+
+TEST_CASE("Upcoming repetitions with one reversible move",
+          "[board][repetition]") {
+  namespace flags = constants::move::flags;
+
+  board pos{};
+  undo_stack undo{};
+  play(pos, undo,
+       {move{square::g1, square::f3, flags::quiet},
+        move{square::g8, square::f6, flags::quiet},
+        move{square::f3, square::g1, flags::quiet}});
+  CHECK(pos.has_upcoming_repetition(undo, 4));
+  // the position is at (or before) the root
+  CHECK(!pos.has_upcoming_repetition(undo, 3));
+
+  // the rook would return to a1 through the knight on a2 (the black king is
+  // only back on e8 seven plies later)
+  const auto detour = {move{square::e8, square::d8, flags::quiet},
+                       move{square::a1, square::b1, flags::quiet},
+                       move{square::d8, square::c8, flags::quiet},
+                       move{square::b1, square::b4, flags::quiet},
+                       move{square::c8, square::d8, flags::quiet},
+                       move{square::b4, square::a4, flags::quiet},
+                       move{square::d8, square::e8, flags::quiet}};
+  board blocked_pos{"4k3/8/8/8/8/8/N7/R3K3 b - - 0 1"};
+  undo.clear();
+  play(blocked_pos, undo, detour);
+  CHECK(!blocked_pos.has_upcoming_repetition(undo, 8));
+
+  board open_pos{"4k3/8/8/8/8/8/8/R3K3 b - - 0 1"};
+  undo.clear();
+  play(open_pos, undo, detour);
+  CHECK(open_pos.has_upcoming_repetition(undo, 8));
+}
+
+TEST_CASE("Repetition detection matches playing the moves",
+          "[board][repetition]") {
+  for (const auto fen : repetition_fens) {
+    board pos{fen};
+    undo_stack undo{};
+    CHECK(n_mismatches(pos, undo, 5) == 0);
+  }
+}
@@ -0,0 +1,62 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/enums.hpp"
+#include "mpham_chess/move.hpp"
+#include "mpham_chess/movegen.hpp"
+#include "mpham_chess/movelist.hpp"
+using namespace mpham_chess;
+
+TEST_CASE("Moves are picked by descending score", "[movelist][scored]") {
+  const board pos{
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"};
+  scored_move_list scored_mvlist{};
+  generate_moves<move_gen_type::pseudolegal>(pos, scored_mvlist.get_moves());
+  scored_mvlist.score_moves([](move mv) -> move_score {
+    return static_cast<move_score>(mv.get_flags());
+  });
+  const auto mvlist{scored_mvlist.get_moves()};
+  REQUIRE(scored_mvlist.size() == mvlist.size());
+
+  std::optional<move_score> prev_score{};
+  std::size_t n_picked{0};
+  while (const auto mv{scored_mvlist.pick_next()}) {
+    const auto score{static_cast<move_score>(mv->get_flags())};
+    CHECK(scored_mvlist.get_score(n_picked) == score);
+    CHECK(std::find(mvlist.begin(), mvlist.end(), *mv) != mvlist.end());
+    if (prev_score) {
+      CHECK(score <= *prev_score);
+    }
+    prev_score = score;
+    n_picked++;
+  }
+  CHECK(n_picked == mvlist.size());
+  CHECK(scored_mvlist.n_remaining() == 0);
+}
+
+TEST_CASE("Moves added after picking are picked next", "[movelist][scored]") {
+  const move e2e4{square::e2, square::e4,
+                  constants::move::flags::double_pawn_push};
+  const move d2d4{square::d2, square::d4,
+                  constants::move::flags::double_pawn_push};
+  const move g1f3{square::g1, square::f3, constants::move::flags::quiet};
+
+  scored_move_list scored_mvlist{};
+  scored_mvlist.push_back(e2e4, 10);
+  scored_mvlist.push_back(d2d4, 20);
+  CHECK(scored_mvlist.pick_next() == d2d4);
+
+  scored_mvlist.get_moves().push_back(g1f3);
+  scored_mvlist.score_moves([](move) -> move_score { return 15; });
+  CHECK(scored_mvlist.pick_next() == g1f3);
+  CHECK(scored_mvlist.pick_next() == e2e4);
+  CHECK(!scored_mvlist.pick_next());
+
+  scored_mvlist.clear();
+  CHECK(scored_mvlist.size() == 0);
+  CHECK(!scored_mvlist.pick_next());
+}
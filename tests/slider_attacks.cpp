@@ -0,0 +1,59 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "mpham_chess/attacks.hpp"
+#include "mpham_chess/bitboard.hpp"
+#include "mpham_chess/constants.hpp"
+#include "mpham_chess/enums.hpp"
+using namespace mpham_chess;
+
+namespace {
+
+template <piece_type pt> bool magic_lookup_matches_ray_attacks() {
+  // every relevant blocker subset of every square must map to the same
+  // attacks as the (slow) ray fill
+  for (auto sq_ind{0}; sq_ind < constants::n_squares; sq_ind++) {
+    const square sq{sq_ind};
+    const bitboard sq_bb{sq};
+    const auto relevant_blockers{
+        attacks::magics::relevant_blocker_mask<pt>(sq)};
+
+    auto block_subset{constants::bb::empty};
+    do {
+      block_subset = (block_subset - relevant_blockers) & relevant_blockers;
+
+      // irrelevant blockers (edges, the slider itself) must not matter
+      const auto blockers{block_subset | ~relevant_blockers};
+      if (attacks::slider_attacks<pt>(sq, blockers) !=
+          attacks::slider_attacks<pt>(sq_bb, blockers)) {
+        return false;
+      }
+    } while (!block_subset.is_empty());
+  }
+  return true;
+}
+
+} // namespace
+
+TEST_CASE("Magic bishop attacks match ray attacks", "[attacks][magics]") {
+  CHECK(magic_lookup_matches_ray_attacks<piece_type::bishop>());
+}
+
+TEST_CASE("Magic rook attacks match ray attacks", "[attacks][magics]") {
+  CHECK(magic_lookup_matches_ray_attacks<piece_type::rook>());
+}
+
+TEST_CASE("Bitboard pext", "[attacks][magics]") {
+  STATIC_CHECK(bitboard{0b1011}.pext(bitboard{0b1110}) == bitboard{0b101});
+  CHECK(bitboard{0xf0f0}.pext(bitboard{0xff00}) == bitboard{0xf0});
+  CHECK(constants::bb::universe.pext(constants::bb::file_a) == bitboard{0xff});
+}
+
+TEST_CASE("Magic tables are precomputed", "[attacks][magics]") {
+  using attacks::magics::slider_attack_table_size;
+  using attacks::magics::slider_magics;
+
+  // fancy magics with no shared entries: sum of 2^(relevant blockers)
+  STATIC_CHECK(slider_attack_table_size<piece_type::bishop> == 5'248);
+  STATIC_CHECK(slider_attack_table_size<piece_type::rook> == 102'400);
+  STATIC_CHECK(slider_magics<piece_type::rook>[0]._key_shift == 64 - 12);
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "mpham_chess/board.hpp"
+#include "mpham_chess/movegen.hpp"
+#include "mpham_chess/movelist.hpp"
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+namespace test_utils {
+
+// positions with castling, enpassant, promotions, pins and Chess960 castling
+inline constexpr std::array<std::string_view, 4> walk_fens{
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "bqnb1rkr/pp3ppp/3ppn2/2p5/5P2/P2P4/NPP1P1PP/BQ1BNRKR w HFhf - 2 9"};
+
+template <typename predicate_t>
+std::size_t n_walk_mismatches(mpham_chess::board &pos, unsigned int depth,
+                              predicate_t &&matches) {
+  // walks the legal move tree of `pos` to `depth` with do/undo and counts the
+  // nodes where `matches(pos)` is false, checked on entering a node and again
+  // after its moves are undone
+  std::size_t mismatches{!matches(pos)};
+  if (depth == 0) {
+    return mismatches;
+  }
+
+  mpham_chess::move_list mvlist{};
+  mpham_chess::generate_moves<mpham_chess::move_gen_type::legal>(pos, mvlist);
+  for (auto mv : mvlist) {
+    mpham_chess::state_info prev_state{};
+    pos.do_move(mv, prev_state);
+    mismatches += n_walk_mismatches(pos, depth - 1, matches);
+    pos.undo_move(mv, prev_state);
+  }
+  return mismatches + !matches(pos);
+}
+
+} // namespace test_utils